@@ -0,0 +1,106 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef COUNTING_BIT_STREAM_H__
+#define COUNTING_BIT_STREAM_H__
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <assert.h>
+#include "writebitstream.h"
+
+// A stand in for WriteBitstream that only counts the bits written, for finding the compressed size of a mesh without writing
+// it (e.g. to compare FIFO sizes or quantisations). Sizes match what a WriteBitstream would give for the same writes.
+class CountingBitstream
+{
+public:
+
+    // The capacity is ignored, as nothing is stored.
+    CountingBitstream( size_t = 0 ) : m_size( 0 ) {}
+
+    // Size in bits.
+    size_t Size() const { return m_size; }
+
+    // Get the size in bytes
+    size_t ByteSize() const { return ( m_size + 7 ) >> 3; }
+
+    // Count a number of bits.
+    void Write( uint32_t, uint32_t bitCount ) { m_size += bitCount; }
+
+    // Count the bytes of a V int.
+    void WriteVInt( uint32_t value );
+
+    // Nothing to flush.
+    void Finish() {}
+
+    // Count the zero bits up to the next byte boundary.
+    void AlignToByte() { m_size = ( m_size + 7 ) & ~static_cast< size_t >( 7 ); }
+
+    // Count the bits of another counting stream.
+    void Append( const CountingBitstream& other ) { m_size += other.m_size; }
+
+    // Start counting again from 0.
+    void Reset() { m_size = 0; }
+
+    // Count a prefix code from the coding table.
+    template <typename Ty>
+    void WritePrefixCode( Ty input, const PrefixCode* codes ) { m_size += codes[ input ].bitLength; }
+
+    // Count a universal code, returning the k that would provide the smallest encoding, as with WriteBitstream.
+    uint32_t WriteUniversal( uint32_t value, uint32_t k );
+
+    uint32_t WriteUniversalZigZag( int32_t value, uint32_t k ) { return WriteUniversal( WriteBitstream::EncodeZigZag( value ), k ); }
+
+private:
+
+    size_t m_size;
+};
+
+
+WBS_INLINE void CountingBitstream::WriteVInt( uint32_t value )
+{
+    do
+    {
+        value >>= 7;
+        m_size += 8;
+
+    } while ( value > 0 );
+}
+
+
+WBS_INLINE uint32_t CountingBitstream::WriteUniversal( uint32_t value, uint32_t k )
+{
+    assert( k < 32 );
+    assert( value < 0x80000000 );
+
+    uint32_t bits = WriteBitstream::Log2( ( value << 1 ) | 1 );
+
+    m_size += bits <= k ? k + 1 : ( bits << 1 ) - k;
+
+    return bits;
+}
+
+
+#endif // -- COUNTING_BIT_STREAM_H__
@@ -25,9 +25,21 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // NOTE - these tables are in this file for readability / navagability and should *only* be included in
 // indexbufferdecompression.cpp for index buffer compression and meshdecompression.cpp for mesh compression
+//
+// Generated by meshtablegenerator.cpp, which keeps the encoding and decoding tables consistent, so regenerate them
+// with it rather than editing them by hand.
 
 #pragma once
 
+// The longest code in each decoding table, which is the number of bits looked up at a time.
+static const uint32_t TRIANGLE_MAX_CODE_LENGTH  = 7;
+static const uint32_t VERTEX_MAX_CODE_LENGTH    = 8;
+static const uint32_t EDGE_MAX_CODE_LENGTH      = 11;
+static const uint32_t EDGE_16_MAX_CODE_LENGTH   = 10;
+static const uint32_t VERTEX_16_MAX_CODE_LENGTH = 6;
+static const uint32_t EDGE_64_MAX_CODE_LENGTH   = 11;
+static const uint32_t VERTEX_64_MAX_CODE_LENGTH = 10;
+
 // Prefix code decoding table used for triangle codes
 static const PrefixCodeTableEntry TriangleDecoding[] =
 {
@@ -2474,3 +2486,4183 @@ static const PrefixCodeTableEntry EdgeDecoding[] =
     { 1, 2 },
     { 3, 4 }
 };
+
+// Prefix code decoding table used for edge fifo codes with a 16 entry edge FIFO (MCF_FIFO_16)
+static const PrefixCodeTableEntry EdgeDecoding16[] =
+{
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 7, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 5, 10 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 7, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 4 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 14, 10 }
+};
+
+// Prefix code decoding table used for vertex fifo codes with a 16 entry vertex FIFO (MCF_FIFO_16)
+static const PrefixCodeTableEntry VertexDecoding16[] =
+{
+    { 0, 3 },
+    { 4, 4 },
+    { 2, 3 },
+    { 11, 4 },
+    { 1, 3 },
+    { 7, 4 },
+    { 3, 3 },
+    { 9, 5 },
+    { 0, 3 },
+    { 5, 4 },
+    { 2, 3 },
+    { 6, 5 },
+    { 1, 3 },
+    { 10, 4 },
+    { 3, 3 },
+    { 15, 5 },
+    { 0, 3 },
+    { 4, 4 },
+    { 2, 3 },
+    { 11, 4 },
+    { 1, 3 },
+    { 7, 4 },
+    { 3, 3 },
+    { 14, 5 },
+    { 0, 3 },
+    { 5, 4 },
+    { 2, 3 },
+    { 8, 5 },
+    { 1, 3 },
+    { 10, 4 },
+    { 3, 3 },
+    { 12, 6 },
+    { 0, 3 },
+    { 4, 4 },
+    { 2, 3 },
+    { 11, 4 },
+    { 1, 3 },
+    { 7, 4 },
+    { 3, 3 },
+    { 9, 5 },
+    { 0, 3 },
+    { 5, 4 },
+    { 2, 3 },
+    { 6, 5 },
+    { 1, 3 },
+    { 10, 4 },
+    { 3, 3 },
+    { 15, 5 },
+    { 0, 3 },
+    { 4, 4 },
+    { 2, 3 },
+    { 11, 4 },
+    { 1, 3 },
+    { 7, 4 },
+    { 3, 3 },
+    { 14, 5 },
+    { 0, 3 },
+    { 5, 4 },
+    { 2, 3 },
+    { 8, 5 },
+    { 1, 3 },
+    { 10, 4 },
+    { 3, 3 },
+    { 13, 6 }
+};
+
+// Prefix code decoding table used for edge fifo codes with a 64 entry edge FIFO (MCF_FIFO_64)
+static const PrefixCodeTableEntry EdgeDecoding64[] =
+{
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 7, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 30, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 14, 10 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 47, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 39, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 22, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 55, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 34, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 16, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 51, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 21, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 43, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 26, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 59, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 7, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 32, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 5, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 49, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 41, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 24, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 57, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 36, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 18, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 53, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 21, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 45, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 28, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 61, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 7, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 31, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 14, 10 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 48, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 40, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 23, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 56, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 35, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 17, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 52, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 21, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 44, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 27, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 60, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 7, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 33, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 15, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 50, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 10, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 42, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 25, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 58, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 9, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 6, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 38, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 19, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 20, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 54, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 11, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 21, 9 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 13, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 4, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 46, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 12, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 3, 6 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 29, 11 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 2, 5 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 37, 8 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 8, 7 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 63, 3 },
+    { 0, 1 },
+    { 1, 2 },
+    { 0, 1 },
+    { 62, 11 }
+};
+
+// Prefix code decoding table used for vertex fifo codes with a 64 entry vertex FIFO (MCF_FIFO_64)
+static const PrefixCodeTableEntry VertexDecoding64[] =
+{
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 27, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 35, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 37, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 47, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 30, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 41, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 46, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 12, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 58, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 28, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 39, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 43, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 53, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 34, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 44, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 49, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 26, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 54, 10 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 27, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 38, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 37, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 51, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 30, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 42, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 46, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 12, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 60, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 28, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 40, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 43, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 55, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 34, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 45, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 49, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 26, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 57, 10 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 27, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 35, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 37, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 47, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 30, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 41, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 46, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 12, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 58, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 28, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 39, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 43, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 53, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 34, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 44, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 49, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 26, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 56, 10 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 27, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 38, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 37, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 51, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 30, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 42, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 46, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 12, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 60, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 36, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 28, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 59, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 8, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 40, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 50, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 43, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 63, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 24, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 55, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 22, 6 },
+    { 3, 3 },
+    { 9, 6 },
+    { 7, 4 },
+    { 48, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 31, 6 },
+    { 3, 3 },
+    { 17, 6 },
+    { 4, 5 },
+    { 34, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 25, 6 },
+    { 3, 3 },
+    { 13, 6 },
+    { 7, 4 },
+    { 61, 7 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 20, 7 },
+    { 3, 3 },
+    { 19, 6 },
+    { 5, 5 },
+    { 45, 9 },
+    { 1, 3 },
+    { 6, 5 },
+    { 0, 4 },
+    { 23, 6 },
+    { 3, 3 },
+    { 10, 6 },
+    { 7, 4 },
+    { 52, 7 },
+    { 1, 3 },
+    { 14, 5 },
+    { 2, 4 },
+    { 33, 6 },
+    { 3, 3 },
+    { 18, 6 },
+    { 4, 5 },
+    { 49, 8 },
+    { 1, 3 },
+    { 11, 5 },
+    { 0, 4 },
+    { 29, 6 },
+    { 3, 3 },
+    { 15, 6 },
+    { 7, 4 },
+    { 26, 8 },
+    { 1, 3 },
+    { 16, 5 },
+    { 2, 4 },
+    { 32, 7 },
+    { 3, 3 },
+    { 21, 6 },
+    { 5, 5 },
+    { 62, 10 }
+};
@@ -25,134 +25,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // NOTE - these tables are in this file for readability / navagability and should *only* be included in
 // indexbuffercompression.cpp for index buffer compression and meshcompression.cpp for mesh compression
+//
+// Generated by meshtablegenerator.cpp, which keeps the encoding and decoding tables consistent, so regenerate them
+// with it rather than editing them by hand.
 
 #pragma once
 
-// Individual vertex type classifications.
-enum VertexClassification
-{
-    NEW_VERTEX = 0,
-    CACHED_VERTEX = 1,
-    FREE_VERTEX = 2
-};
-
-// Individual case for handling a combination of vertice classifications.
-struct VertexCompressionCase
-{
-    IndexBufferTriangleCodes code;
-    uint32_t vertexOrder[ 3 ];
-};
-
-// This is a table for looking up the appropriate code and rotation for a set of vertex classifications.
-static const VertexCompressionCase CompressionCase[3][3][3] =
-{
-    { // new 
-        { // new new
-            { // new new new 
-                IB_NEW_NEW_NEW, { 0, 1, 2 }
-            },
-            { // new new cached
-                IB_NEW_NEW_CACHED, { 0, 1, 2 }
-            },
-            { // new new free
-                IB_NEW_NEW_FREE, { 0, 1, 2 }
-            }
-        },
-        { // new cached
-            { // new cached new
-                IB_NEW_NEW_CACHED, { 2, 0, 1 }
-            },
-            {  // new cached cached
-                IB_NEW_CACHED_CACHED, { 0, 1, 2 }
-            },
-            { // new cached free
-                IB_NEW_CACHED_FREE, { 0, 1, 2 }
-            }
-        },
-        { // new free
-            { // new free new
-                IB_NEW_NEW_FREE, { 2, 0, 1 }
-            },
-            { // new free cached
-                IB_NEW_FREE_CACHED, { 0, 1, 2 }
-            },
-            { // new free free
-                IB_NEW_FREE_FREE, { 0, 1, 2 }
-            }
-        }
-    },
-    { // cached
-        { // cached new 
-            { // cached new new
-                IB_NEW_NEW_CACHED, { 1, 2, 0 }
-            },
-            { // cached new cached
-                IB_NEW_CACHED_CACHED, { 1, 2, 0 }
-            },
-            { // cached new free
-                IB_NEW_FREE_CACHED, { 1, 2, 0 }
-            }
-        },
-        { // cached cached
-            { // cached cached new
-                IB_NEW_CACHED_CACHED, { 2, 0, 1 }
-            },
-            { // cached cached cached
-                IB_CACHED_CACHED_CACHED, { 0, 1, 2 }
-            },
-            { // cached cached free
-                IB_CACHED_CACHED_FREE, { 0, 1, 2 }
-            }
-        },
-        { // cached free
-            { // cached free new
-                IB_NEW_CACHED_FREE, { 2, 0, 1 }
-            },
-            { // cached free cached
-                IB_CACHED_CACHED_FREE, { 2, 0, 1 }
-            },
-            { // cached free free 
-                IB_CACHED_FREE_FREE, { 0, 1, 2 }
-            }
-        }
-    },
-    { // free
-        { // free new
-            { // free new new
-                IB_NEW_NEW_FREE, { 1, 2, 0 }
-            },
-            { // free new cached
-                IB_NEW_CACHED_FREE, { 1, 2, 0 }
-            },
-            { // free new free
-                IB_NEW_FREE_FREE, { 1, 2, 0 }
-            }
-        },
-        { // free cached
-            { // free cached new
-                IB_NEW_FREE_CACHED, { 2, 0, 1 }
-            },
-            { // free cached cached
-                IB_CACHED_CACHED_FREE, { 1, 2, 0 }
-            },
-            { // free cached free
-                IB_CACHED_FREE_FREE, { 1, 2, 0 }
-            }
-        },
-        { // free free
-            { // free free new
-                IB_NEW_FREE_FREE, { 2, 0, 1 }
-            },
-            { // free free cached
-                IB_CACHED_FREE_FREE, { 2, 0, 1 }
-            },
-            { // free free free
-                IB_FREE_FREE_FREE, { 0, 1, 2 }
-            }
-        }
-    }
-};
-
 // Prefix code table used for encoding edge bits
 static const PrefixCode EdgePrefixCodes[] =
 {
@@ -227,6 +105,186 @@ static const PrefixCode CachedVertexPrefixCodes[] =
     { 57, 8 }
 };
 
+// Prefix code table used for encoding edge bits with a 16 entry edge FIFO (MCF_FIFO_16)
+static const PrefixCode EdgePrefixCodes16[] =
+{
+    { 0, 1 },
+    { 1, 2 },
+    { 7, 4 },
+    { 15, 6 },
+    { 31, 7 },
+    { 511, 10 },
+    { 127, 9 },
+    { 383, 9 },
+    { 255, 9 },
+    { 95, 8 },
+    { 223, 8 },
+    { 63, 8 },
+    { 191, 8 },
+    { 47, 6 },
+    { 1023, 10 },
+    { 3, 3 }
+};
+
+// Prefix code table used for vertices with a 16 entry vertex FIFO (MCF_FIFO_16)
+static const PrefixCode CachedVertexPrefixCodes16[] =
+{
+    { 0, 3 },
+    { 4, 3 },
+    { 2, 3 },
+    { 6, 3 },
+    { 1, 4 },
+    { 9, 4 },
+    { 11, 5 },
+    { 5, 4 },
+    { 27, 5 },
+    { 7, 5 },
+    { 13, 4 },
+    { 3, 4 },
+    { 31, 6 },
+    { 63, 6 },
+    { 23, 5 },
+    { 15, 5 }
+};
+
+// Prefix code table used for encoding edge bits with a 64 entry edge FIFO (MCF_FIFO_64)
+static const PrefixCode EdgePrefixCodes64[] =
+{
+    { 0, 1 },
+    { 1, 2 },
+    { 7, 5 },
+    { 23, 6 },
+    { 55, 7 },
+    { 607, 11 },
+    { 47, 8 },
+    { 31, 9 },
+    { 119, 7 },
+    { 287, 9 },
+    { 159, 9 },
+    { 15, 7 },
+    { 79, 7 },
+    { 175, 8 },
+    { 95, 10 },
+    { 1631, 11 },
+    { 351, 11 },
+    { 1375, 11 },
+    { 863, 11 },
+    { 1887, 11 },
+    { 111, 8 },
+    { 415, 9 },
+    { 223, 11 },
+    { 1247, 11 },
+    { 735, 11 },
+    { 1759, 11 },
+    { 479, 11 },
+    { 1503, 11 },
+    { 991, 11 },
+    { 2015, 11 },
+    { 63, 11 },
+    { 1087, 11 },
+    { 575, 11 },
+    { 1599, 11 },
+    { 319, 11 },
+    { 1343, 11 },
+    { 831, 11 },
+    { 239, 8 },
+    { 1855, 11 },
+    { 191, 11 },
+    { 1215, 11 },
+    { 703, 11 },
+    { 1727, 11 },
+    { 447, 11 },
+    { 1471, 11 },
+    { 959, 11 },
+    { 1983, 11 },
+    { 127, 11 },
+    { 1151, 11 },
+    { 639, 11 },
+    { 1663, 11 },
+    { 383, 11 },
+    { 1407, 11 },
+    { 895, 11 },
+    { 1919, 11 },
+    { 255, 11 },
+    { 1279, 11 },
+    { 767, 11 },
+    { 1791, 11 },
+    { 511, 11 },
+    { 1535, 11 },
+    { 1023, 11 },
+    { 2047, 11 },
+    { 3, 3 }
+};
+
+// Prefix code table used for vertices with a 64 entry vertex FIFO (MCF_FIFO_64)
+static const PrefixCode CachedVertexPrefixCodes64[] =
+{
+    { 2, 4 },
+    { 0, 3 },
+    { 10, 4 },
+    { 4, 3 },
+    { 14, 5 },
+    { 30, 5 },
+    { 1, 5 },
+    { 6, 4 },
+    { 27, 7 },
+    { 5, 6 },
+    { 37, 6 },
+    { 17, 5 },
+    { 119, 8 },
+    { 21, 6 },
+    { 9, 5 },
+    { 53, 6 },
+    { 25, 5 },
+    { 13, 6 },
+    { 45, 6 },
+    { 29, 6 },
+    { 91, 7 },
+    { 61, 6 },
+    { 3, 6 },
+    { 35, 6 },
+    { 59, 7 },
+    { 19, 6 },
+    { 247, 8 },
+    { 15, 8 },
+    { 143, 8 },
+    { 51, 6 },
+    { 79, 8 },
+    { 11, 6 },
+    { 123, 7 },
+    { 43, 6 },
+    { 207, 8 },
+    { 31, 9 },
+    { 7, 7 },
+    { 47, 8 },
+    { 287, 9 },
+    { 159, 9 },
+    { 415, 9 },
+    { 95, 9 },
+    { 351, 9 },
+    { 175, 8 },
+    { 223, 9 },
+    { 479, 9 },
+    { 111, 8 },
+    { 63, 9 },
+    { 71, 7 },
+    { 239, 8 },
+    { 39, 7 },
+    { 319, 9 },
+    { 103, 7 },
+    { 191, 9 },
+    { 255, 10 },
+    { 447, 9 },
+    { 767, 10 },
+    { 511, 10 },
+    { 127, 9 },
+    { 23, 7 },
+    { 383, 9 },
+    { 87, 7 },
+    { 1023, 10 },
+    { 55, 7 }
+};
+
 // Prefix code table used for triangles
 static const PrefixCode TrianglePrefixCodes[] =
 {
@@ -245,6 +303,3 @@ static const PrefixCode TrianglePrefixCodes[] =
     { 1, 6 },
     { 97, 7 }
 };
-
-// Constant value for vertices that don't get mapped in the vertex re-map.
-static const uint32_t VERTEX_NOT_MAPPED = 0xFFFFFFFF;
@@ -43,9 +43,22 @@ const uint32_t VERTEX_FIFO_SIZE      = 32;
 const uint32_t VERTEX_FIFO_MASK      = VERTEX_FIFO_SIZE - 1;
 const uint32_t EDGE_FIFO_SIZE        = 32;
 const uint32_t EDGE_FIFO_MASK        = EDGE_FIFO_SIZE - 1;
+
 const uint32_t CACHED_EDGE_BITS      = 5;
 const uint32_t CACHED_VERTEX_BITS    = 5;
 
+// Meshes can also be compressed with 16 or 64 entry FIFOs (MCF_FIFO_16 and MCF_FIFO_64), rather than the default 32.
+const uint32_t MAX_FIFO_SIZE         = 64;
+
+// The compressor and decompressor keep the k estimate for each vertex attribute on the stack for up to this many attributes.
+// Meshes with more attributes keep them in a scratch buffer (see MeshCompressionOptions::attributeScratch and DecompressMesh).
+const uint32_t MESH_INLINE_ATTRIBUTE_COUNT = 64;
+
+// For meshes compressed with MCF_LONG_EDGES, the last edge FIFO position (FIFO size - 1) is an escape rather than an edge.
+// It's followed by a vint reference to an edge of any earlier triangle, ( ( triangles back - 1 ) * 3 ) + the edge within that
+// triangle, where edge n of a decompressed triangle runs from vertex n to vertex n + 1 and the vertex after that is opposite it.
+ICC_INLINE uint32_t LongEdgeEscape( uint32_t fifoSize ) { return fifoSize - 1; }
+
 const uint32_t IB_VERTEX_CODE_BITS   = 2;
 
 const uint32_t IB_TRIANGLE_CODE_BITS = 4;
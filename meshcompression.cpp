@@ -24,9 +24,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 #include "meshcompression.h"
 #include "writebitstream.h"
+#include "countingbitstream.h"
 #include "indexcompressionconstants.h"
 #include "meshcompressionconstants.h"
+#include "meshparallel.h"
+#include "prefixcodebuilder.h"
 #include <assert.h>
+#include <string.h>
 
 #ifdef _MSC_VER
 #define MC_INLINE __forceinline
@@ -34,583 +38,2311 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define MC_INLINE inline
 #endif 
 
+// FIFO probing compares all of the FIFO entries at once with SIMD where it's available. SSE2 is part of every x86-64 target,
+// and AVX2 is used when the compiler is targeting it (e.g. -mavx2 or /arch:AVX2). Otherwise the FIFOs are probed one entry at a time.
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#define MC_FIFO_SIMD 1
+#define MC_FIFO_AVX2 1
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define MC_FIFO_SIMD 1
+#define MC_FIFO_SSE2 1
+#endif
+
+#include "indexbuffercompressioncases.h"
 #include "indexbufferencodetables.h"
 
-// Classify a vertex as new, cached or free, outputting the relative position in the vertex indice cache FIFO.
-static MC_INLINE VertexClassification ClassifyVertex( uint32_t vertex, const uint32_t* vertexRemap, const uint32_t* vertexFifo, uint32_t verticesRead, uint32_t& cachedVertexIndex )
+// The edge and cached vertex prefix code tables for each FIFO size (the codes are fitted to the distance distributions at that size).
+template < uint32_t FifoSize >
+struct FifoPrefixCodes;
+
+template <>
+struct FifoPrefixCodes< 16 >
 {
-    if ( vertexRemap[ vertex ] == VERTEX_NOT_MAPPED )
+    static MC_INLINE const PrefixCode* Edges() { return EdgePrefixCodes16; }
+    static MC_INLINE const PrefixCode* CachedVertices() { return CachedVertexPrefixCodes16; }
+};
+
+template <>
+struct FifoPrefixCodes< 32 >
+{
+    static MC_INLINE const PrefixCode* Edges() { return EdgePrefixCodes; }
+    static MC_INLINE const PrefixCode* CachedVertices() { return CachedVertexPrefixCodes; }
+};
+
+template <>
+struct FifoPrefixCodes< 64 >
+{
+    static MC_INLINE const PrefixCode* Edges() { return EdgePrefixCodes64; }
+    static MC_INLINE const PrefixCode* CachedVertices() { return CachedVertexPrefixCodes64; }
+};
+
+// Statistics policy that gathers nothing, so statistics compile out of the default compression path entirely.
+struct NullCompressionStats
+{
+    MC_INLINE void TriangleCode( IndexBufferTriangleCodes ) {}
+    MC_INLINE void Edge( uint32_t ) {}
+    MC_INLINE void LongEdge() {}
+    MC_INLINE void CachedVertex( uint32_t ) {}
+    MC_INLINE void FreeVertex( uint32_t ) {}
+    MC_INLINE void Attribute( uint32_t, size_t ) {}
+    MC_INLINE void RecodeAttribute( uint32_t, size_t, size_t ) {}
+    MC_INLINE void Finish( size_t ) {}
+};
+
+// Statistics policy that fills out a MeshCompressionStats.
+class GatherCompressionStats
+{
+public:
+
+    GatherCompressionStats( MeshCompressionStats& stats ) : m_stats( stats )
     {
-        return NEW_VERTEX;
+        ::memset( &stats, 0, sizeof( stats ) );
     }
-    else
+
+    void TriangleCode( IndexBufferTriangleCodes code ) { ++m_stats.triangleCodes[ code ]; }
+
+    void Edge( uint32_t relativeEdge ) { ++m_stats.edgeDistances[ relativeEdge ]; }
+
+    void LongEdge() { ++m_stats.longEdgeCount; }
+
+    void CachedVertex( uint32_t cachedVertexIndex ) { ++m_stats.cachedVertexDistances[ cachedVertexIndex ]; }
+
+    void FreeVertex( uint32_t relativeVertex )
     {
-        int32_t lowestVertexCursor = verticesRead >= VERTEX_FIFO_SIZE ? verticesRead - VERTEX_FIFO_SIZE : 0;
+        uint32_t bytes = 1;
 
-        // Probe backwards in the vertex FIFO for a cached vertex
-        for ( int32_t vertexCursor = verticesRead - 1; vertexCursor >= lowestVertexCursor; --vertexCursor )
+        for ( uint32_t remaining = relativeVertex >> 7; remaining > 0; remaining >>= 7 )
         {
-            if ( vertexFifo[ vertexCursor & VERTEX_FIFO_MASK ] == vertex )
-            {
-                cachedVertexIndex = ( verticesRead - 1 ) - vertexCursor;
+            ++bytes;
+        }
 
-                return CACHED_VERTEX;
-            }
+        ++m_stats.freeVertexCount;
+        ++m_stats.freeVertexBytes[ bytes - 1 ];
+
+        m_stats.freeVertexDistanceTotal += relativeVertex;
+
+        if ( relativeVertex > m_stats.freeVertexDistanceMax )
+        {
+            m_stats.freeVertexDistanceMax = relativeVertex;
         }
+    }
 
-        return FREE_VERTEX;
+    void Attribute( uint32_t column, size_t bits )
+    {
+        uint32_t lastColumn = MeshCompressionStats::MAX_ATTRIBUTE_COLUMNS - 1;
+
+        m_stats.attributeBits[ column < lastColumn ? column : lastColumn ] += bits;
     }
-}
 
+    // An attribute column's residuals were coded again after compression (with MCF_RANS_ATTRIBUTES), taking codedBits
+    // rather than the originalBits counted for them.
+    void RecodeAttribute( uint32_t column, size_t originalBits, size_t codedBits )
+    {
+        uint32_t lastColumn = MeshCompressionStats::MAX_ATTRIBUTE_COLUMNS - 1;
 
-// Compress using triangle codes/prefix coding.
-template <typename IndiceType, typename AttributeType>
-void CompressMesh(
-    const IndiceType* triangles,
-    uint32_t triangleCount,
-    uint32_t* vertexRemap,
-    uint32_t vertexCount,
-    uint32_t vertexAttributeCount,
-    const AttributeType* vertexAttributes,
-    WriteBitstream& output )
-{
-    EdgeTriangle edgeFifo[ EDGE_FIFO_SIZE ];
-    uint32_t     vertexFifo[ VERTEX_FIFO_SIZE ];
+        m_stats.attributeBits[ column < lastColumn ? column : lastColumn ] += codedBits;
+        m_stats.attributeBits[ column < lastColumn ? column : lastColumn ] -= originalBits;
+    }
 
-    uint32_t          edgesRead    = 0;
-    uint32_t          verticesRead = 0;
-    uint32_t          newVertices  = 0;
-    const IndiceType* triangleEnd  = triangles + ( triangleCount * 3 );
+    // Anything that wasn't an attribute is topology.
+    void Finish( size_t totalBits )
+    {
+        uint64_t attributeTotal = 0;
 
-    assert( vertexCount < 0xFFFFFFFF );
+        for ( uint32_t column = 0; column < MeshCompressionStats::MAX_ATTRIBUTE_COLUMNS; ++column )
+        {
+            attributeTotal += m_stats.attributeBits[ column ];
+        }
 
-    uint32_t* vertexRemapEnd = vertexRemap + vertexCount;
+        m_stats.topologyBits = totalBits - attributeTotal;
+    }
 
-    // array of exponential moving average values to estimate optimal k for exp golomb codes
-    // note we use 16/16 unsigned fixed point.
-    uint32_t kArray[ 64 ];
+private:
 
-    for ( uint32_t vertexAttributeIndex = 0; vertexAttributeIndex < vertexAttributeCount; ++vertexAttributeIndex )
+    // Not assignable
+    GatherCompressionStats& operator=( const GatherCompressionStats& );
+
+    MeshCompressionStats& m_stats;
+};
+
+// Statistics policy for the counting pass of MCF_ADAPTIVE_CODES, which also counts the triangle codes in each of the contexts used
+// with MCF_TRIANGLE_CONTEXTS.
+class GatherContextCompressionStats : public GatherCompressionStats
+{
+public:
+
+    GatherContextCompressionStats( MeshCompressionStats& stats ) : GatherCompressionStats( stats ), m_triangleContext( 0 )
     {
-        // prime the array of ks for exp golomb with an average bitsize of 4
-        // note that k is 
-        kArray[ vertexAttributeIndex ] = 4 << 16;
+        ::memset( contextTriangleCodes, 0, sizeof( contextTriangleCodes ) );
     }
 
-    // clear the vertex remapping to "not found" value of 0xFFFFFFFF - dirty, but low overhead.
-    for ( uint32_t* remappedVertex = vertexRemap; remappedVertex < vertexRemapEnd; ++remappedVertex )
+    void TriangleCode( IndexBufferTriangleCodes code )
     {
-        *remappedVertex = VERTEX_NOT_MAPPED;
+        ++contextTriangleCodes[ m_triangleContext ][ code ];
+
+        m_triangleContext = MeshTriangleCodeContext( code );
+
+        GatherCompressionStats::TriangleCode( code );
     }
 
-    // iterate through the triangles
-    for ( const IndiceType* triangle = triangles; triangle < triangleEnd; triangle += 3 )
-    {
-        int32_t lowestEdgeCursor = edgesRead >= EDGE_FIFO_SIZE ? edgesRead - EDGE_FIFO_SIZE : 0;
-        int32_t edgeCursor       = edgesRead - 1;
-        bool    foundEdge        = false;
+    uint32_t contextTriangleCodes[ MESH_TRIANGLE_CONTEXT_COUNT ][ MESH_TRIANGLE_CODE_COUNT ];
 
-        int32_t spareVertex = 0;
+private:
 
-        // check to make sure that there are no degenerate triangles.
-        assert( triangle[ 0 ] != triangle[ 1 ] && triangle[ 1 ] != triangle[ 2 ] && triangle[ 2 ] != triangle[ 0 ] );
+    uint32_t m_triangleContext;
+};
 
-        // Probe back through the edge fifo to see if one of the triangle edges is in the FIFO
-        for ( ; edgeCursor >= lowestEdgeCursor; --edgeCursor )
-        {
-            const EdgeTriangle& edge = edgeFifo[ edgeCursor & EDGE_FIFO_MASK ];
+// The prefix codes for triangle codes, edge FIFO positions and cached vertex FIFO positions; either the fixed tables for the
+// FIFO size, or ones built for the mesh with MCF_ADAPTIVE_CODES. With MCF_TRIANGLE_CONTEXTS, the triangle codes for each context
+// follow each other, triangleContextStride apart (which is 0 otherwise, so every context uses the same codes).
+struct MeshPrefixCodes
+{
+    const PrefixCode* triangles;
+    const PrefixCode* edges;
+    const PrefixCode* cachedVertices;
+    uint32_t          triangleContextStride;
+};
+
+// Write a triangle code with the codes for the context from the previous triangle code, and move on to the next context.
+template < typename OutputType, typename StatsType >
+static MC_INLINE void WriteTriangleCode( OutputType& output, StatsType& stats, const MeshPrefixCodes& codes, uint32_t& triangleContext, IndexBufferTriangleCodes code )
+{
+    stats.TriangleCode( code );
+    output.WritePrefixCode( code, codes.triangles + triangleContext * codes.triangleContextStride );
 
-            // check all the edges in order and save the free vertex.
-            if ( edge.second == triangle[ 0 ] && edge.first == triangle[ 1 ] )
-            {
-                foundEdge   = true;
-                spareVertex = 2;
-                break;
-            }
-            else if ( edge.second == triangle[ 1 ] && edge.first == triangle[ 2 ] )
-            {
-                foundEdge   = true;
-                spareVertex = 0;
-                break;
-            }
-            else if ( edge.second == triangle[ 2 ] && edge.first == triangle[ 0 ] )
-            {
-                foundEdge   = true;
-                spareVertex = 1;
-                break;
-            }
-        }
+    triangleContext = MeshTriangleCodeContext( code );
+}
 
-        // we found an edge so write it out, so classify a vertex and then write out the correct code.
-        if ( foundEdge )
-        {
-            uint32_t cachedVertex;
+template < typename OutputType, typename StatsType >
+static MC_INLINE void WriteEdge( OutputType& output, StatsType& stats, const MeshPrefixCodes& codes, uint32_t relativeEdge )
+{
+    stats.Edge( relativeEdge );
+    output.WritePrefixCode( relativeEdge, codes.edges );
+}
 
-            uint32_t             spareVertexIndice = triangle[ spareVertex ];
-            VertexClassification freeVertexClass   = ClassifyVertex( spareVertexIndice, vertexRemap, vertexFifo, verticesRead, cachedVertex );
-            uint32_t             relativeEdge      = ( edgesRead - 1 ) - edgeCursor;
+template < typename OutputType, typename StatsType >
+static MC_INLINE void WriteLongEdgeReference( OutputType& output, StatsType& stats, uint32_t reference )
+{
+    stats.LongEdge();
+    output.WriteVInt( reference );
+}
 
-            switch ( freeVertexClass )
-            {
-            case NEW_VERTEX:
-            {
-                output.WritePrefixCode( IB_EDGE_NEW, TrianglePrefixCodes );
-                output.WritePrefixCode( relativeEdge, EdgePrefixCodes );
+template < typename OutputType, typename StatsType >
+static MC_INLINE void WriteCachedVertex( OutputType& output, StatsType& stats, const MeshPrefixCodes& codes, uint32_t cachedVertexIndex )
+{
+    stats.CachedVertex( cachedVertexIndex );
+    output.WritePrefixCode( cachedVertexIndex, codes.cachedVertices );
+}
 
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ] = spareVertexIndice;
-                vertexRemap[ spareVertexIndice ]              = newVertices;
+template < typename OutputType, typename StatsType >
+static MC_INLINE void WriteFreeVertex( OutputType& output, StatsType& stats, uint32_t relativeVertex )
+{
+    stats.FreeVertex( relativeVertex );
+    output.WriteVInt( relativeVertex );
+}
 
-                const EdgeTriangle&  edge               = edgeFifo[ edgeCursor & EDGE_FIFO_MASK ];
-                const AttributeType* adjacent1Attribute = vertexAttributes + ( edge.first * vertexAttributeCount );
-                const AttributeType* adjacent2Attribute = vertexAttributes + ( edge.second * vertexAttributeCount );
-                const AttributeType* opposingAttribute  = vertexAttributes + ( edge.third * vertexAttributeCount );
-                const AttributeType* vertexAttribute    = vertexAttributes + ( spareVertexIndice * vertexAttributeCount );
-                const AttributeType* endAttributes      = vertexAttribute + vertexAttributeCount;
-                uint32_t*            k                  = kArray;
+// Attribute stream policy that writes attribute residuals into the main stream, interleaved with the connectivity.
+template < typename OutputType >
+class InterleavedAttributeStreams
+{
+public:
 
-                for ( ; vertexAttribute < endAttributes; ++adjacent1Attribute, ++adjacent2Attribute, ++opposingAttribute, ++vertexAttribute, ++k )
-                {
-                    int32_t  predicted = int32_t( *adjacent2Attribute ) + ( int32_t( *adjacent1Attribute ) - int32_t( *opposingAttribute ) );
-                    int32_t  delta     = *vertexAttribute - predicted;
-                    uint32_t kEstimate = output.WriteUniversalZigZag( delta, *k >> 16 );
+    typedef OutputType ColumnType;
 
-                    // fixed point exponential moving average with alpha 0.125 (equivalent to N being 31)
-                    *k = ( *k * 7 + ( kEstimate << 16 ) ) >> 3;
-                }
+    InterleavedAttributeStreams( OutputType& output ) : m_output( output ) {}
 
-                ++verticesRead;
-                ++newVertices;
-                break;
-            }
-            case CACHED_VERTEX:
+    MC_INLINE OutputType& Column( uint32_t ) { return m_output; }
 
-                output.WritePrefixCode( IB_EDGE_CACHED, TrianglePrefixCodes );
-                output.WritePrefixCode( relativeEdge, EdgePrefixCodes );
-                output.WritePrefixCode( cachedVertex, CachedVertexPrefixCodes );
+    MC_INLINE void Residual( uint32_t, int32_t ) {}
 
-                break;
+    // Bits written outside of the main stream.
+    size_t SeparateBits() const { return 0; }
 
-            case FREE_VERTEX:
+private:
 
-                output.WritePrefixCode( IB_EDGE_FREE, TrianglePrefixCodes );
-                output.WritePrefixCode( relativeEdge, EdgePrefixCodes );
+    // Not assignable
+    InterleavedAttributeStreams& operator=( const InterleavedAttributeStreams& );
 
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ] = spareVertexIndice;
+    OutputType& m_output;
+};
 
-                ++verticesRead;
+// Attribute stream policy that writes the attribute residuals for each column to its own stream. If residuals isn't NULL, the
+// zig-zag encoded residuals of each column are also kept (residualStride apart) for MCF_RANS_ATTRIBUTES, with residualCounts
+// counting them.
+template < typename OutputType >
+class SeparateAttributeStreams
+{
+public:
 
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ spareVertexIndice ] );
+    typedef OutputType ColumnType;
 
-                break;
-            }
+    SeparateAttributeStreams( OutputType* columns, uint32_t columnCount, uint32_t* residuals, size_t residualStride, uint32_t* residualCounts )
+        : m_columns( columns ), m_columnCount( columnCount ), m_residuals( residuals ), m_residualStride( residualStride ), m_residualCounts( residualCounts ) {}
 
-            // Populate the edge fifo with the remaining edges
-            // Note - the winding order is important as we'll need to re-produce this on decompression.
-            // The edges are put in as if the found edge is the first edge in the triangle (which it will be when we
-            // reconstruct).
-            switch ( spareVertex )
-            {
-            case 0:
+    MC_INLINE OutputType& Column( uint32_t column ) { return m_columns[ column ]; }
 
-                edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 2 ], triangle[ 0 ], triangle[ 1 ] );
+    MC_INLINE void Residual( uint32_t column, int32_t value )
+    {
+        if ( m_residuals != NULL )
+        {
+            m_residuals[ column * m_residualStride + m_residualCounts[ column ]++ ] = WriteBitstream::EncodeZigZag( value );
+        }
+    }
 
-                ++edgesRead;
+    size_t SeparateBits() const
+    {
+        size_t bits = 0;
 
-                edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+        for ( uint32_t column = 0; column < m_columnCount; ++column )
+        {
+            bits += m_columns[ column ].Size();
+        }
 
-                ++edgesRead;
-                break;
+        return bits;
+    }
 
-            case 1:
+private:
 
-                edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+    OutputType*     m_columns;
+    uint32_t        m_columnCount;
+    uint32_t*       m_residuals;
+    size_t          m_residualStride;
+    uint32_t*       m_residualCounts;
+};
 
-                ++edgesRead;
+// Write an attribute residual for the given attribute column, returning the k estimate for it.
+template < typename AttributeStreamsType, typename StatsType >
+static MC_INLINE uint32_t WriteAttribute( AttributeStreamsType& attributeStreams, StatsType& stats, uint32_t column, int32_t value, uint32_t k )
+{
+    typename AttributeStreamsType::ColumnType& output    = attributeStreams.Column( column );
+    size_t                                     startBits = output.Size();
+    uint32_t                                   kEstimate = output.WriteUniversalZigZag( value, k );
 
-                edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 1 ], triangle[ 2 ], triangle[ 0 ] );
+    attributeStreams.Residual( column, value );
+    stats.Attribute( column, output.Size() - startBits );
 
-                ++edgesRead;
-                break;
+    return kEstimate;
+}
 
-            case 2:
+// The compressor's edge FIFO, which also keeps the first and second vertex of each edge in their own arrays, so all of the
+// entries can be compared at once. Entries that haven't been written yet are VERTEX_NOT_MAPPED, so they never match.
+template < uint32_t FifoSize >
+struct EncoderEdgeFifo
+{
+    void Initialise()
+    {
+        ::memset( firsts, 0xFF, sizeof( firsts ) );
+        ::memset( seconds, 0xFF, sizeof( seconds ) );
+    }
 
-                edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 1 ], triangle[ 2 ], triangle[ 0 ] );
+    MC_INLINE void Set( uint32_t cursor, uint32_t first, uint32_t second, uint32_t third )
+    {
+        uint32_t slot = cursor & ( FifoSize - 1 );
 
-                ++edgesRead;
+        entries[ slot ].set( first, second, third );
 
-                edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 2 ], triangle[ 0 ], triangle[ 1 ] );
+        firsts[ slot ]  = first;
+        seconds[ slot ] = second;
+    }
 
-                ++edgesRead;
-                break;
-            }
-        }
-        else
-        {
-            VertexClassification classifications[ 3 ];
-            uint32_t             cachedVertexIndices[ 3 ];
+    MC_INLINE const EdgeTriangle& Get( uint32_t cursor ) const { return entries[ cursor & ( FifoSize - 1 ) ]; }
 
-            // classify each vertex as new, cached or free, potentially extracting a cached indice.
-            classifications[ 0 ] = ClassifyVertex( triangle[ 0 ], vertexRemap, vertexFifo, verticesRead, cachedVertexIndices[ 0 ] );
-            classifications[ 1 ] = ClassifyVertex( triangle[ 1 ], vertexRemap, vertexFifo, verticesRead, cachedVertexIndices[ 1 ] );
-            classifications[ 2 ] = ClassifyVertex( triangle[ 2 ], vertexRemap, vertexFifo, verticesRead, cachedVertexIndices[ 2 ] );
+    EdgeTriangle entries[ FifoSize ];
+    uint32_t     firsts[ FifoSize ];
+    uint32_t     seconds[ FifoSize ];
+};
 
-            // use the classifications to lookup the matching compression code and potentially rotate the order of the vertices.
-            const VertexCompressionCase& compressionCase = CompressionCase[ classifications[ 0 ] ][ classifications[ 1 ] ][ classifications[ 2 ] ];
+#if defined( MC_FIFO_SIMD )
 
-            // rotate the order of the vertices based on the compression classification.
-            uint32_t reorderedTriangle[ 3 ];
+// The number of the newest edges checked one at a time before comparing against the whole edge FIFO.
+static const int32_t EDGE_FIFO_PROBE_COUNT = 2;
 
-            reorderedTriangle[ 0 ] = triangle[ compressionCase.vertexOrder[ 0 ] ];
-            reorderedTriangle[ 1 ] = triangle[ compressionCase.vertexOrder[ 1 ] ];
-            reorderedTriangle[ 2 ] = triangle[ compressionCase.vertexOrder[ 2 ] ];
+// Bitmask of the entries in a FIFO that are equal to value (bit n for slot n).
+template < uint32_t FifoSize >
+static MC_INLINE uint64_t MatchFifo( const uint32_t* fifo, uint32_t value )
+{
+    uint64_t matches = 0;
 
-            output.WritePrefixCode( compressionCase.code, TrianglePrefixCodes );
+#if defined( MC_FIFO_AVX2 )
 
-            switch ( compressionCase.code )
-            {
-            case IB_NEW_NEW_NEW:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = triangle[ 0 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = triangle[ 1 ];
-                vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] = triangle[ 2 ];
+    __m256i key = _mm256_set1_epi32( static_cast< int >( value ) );
 
-                vertexRemap[ triangle[ 0 ] ] = newVertices;
-                vertexRemap[ triangle[ 1 ] ] = newVertices + 1;
-                vertexRemap[ triangle[ 2 ] ] = newVertices + 2;
+    for ( uint32_t slot = 0; slot < FifoSize; slot += 8 )
+    {
+        __m256i equal = _mm256_cmpeq_epi32( _mm256_loadu_si256( reinterpret_cast< const __m256i* >( fifo + slot ) ), key );
 
-                // interleaved verts
-                // encode vert 0 absolute
-                // encode vert 1 relative 0
-                // encode vert 2 relative 0
+        matches |= static_cast< uint64_t >( _mm256_movemask_ps( _mm256_castsi256_ps( equal ) ) ) << slot;
+    }
 
-                const AttributeType*  vert0    = vertexAttributes + ( triangle[ 0 ] * vertexAttributeCount );
-                const AttributeType*  vert1    = vertexAttributes + ( triangle[ 1 ] * vertexAttributeCount );
-                const AttributeType*  vert2    = vertexAttributes + ( triangle[ 2 ] * vertexAttributeCount );
-                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
-                const uint32_t*       k        = kArray;
+#else
 
-                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++vert2, ++k )
-                {
-                    int32_t readVert0  = *vert0;
+    __m128i key = _mm_set1_epi32( static_cast< int >( value ) );
 
-                    output.WriteUniversalZigZag( readVert0, EXP_GOLOMB_FIRST_NEW_K ); 
+    for ( uint32_t slot = 0; slot < FifoSize; slot += 4 )
+    {
+        __m128i equal = _mm_cmpeq_epi32( _mm_loadu_si128( reinterpret_cast< const __m128i* >( fifo + slot ) ), key );
 
-                    int32_t deltaVert1 = *vert1 - readVert0;
+        matches |= static_cast< uint64_t >( _mm_movemask_ps( _mm_castsi128_ps( equal ) ) ) << slot;
+    }
 
-                    output.WriteUniversalZigZag( deltaVert1, ( *k >> 16 ) );
+#endif
 
-                    int32_t deltaVert2 = *vert2 - readVert0;
+    return matches;
+}
 
-                    output.WriteUniversalZigZag( deltaVert2, ( *k >> 16 ) );
-                }
+// Bitmask of the slots in the edge FIFO holding one of the triangle's edges in the opposite winding (edge.second == triangle[ n ]
+// and edge.first == triangle[ n + 1 ]), which are the edges the triangle can be encoded against.
+template < uint32_t FifoSize >
+static MC_INLINE uint64_t MatchEdgeFifo( const EncoderEdgeFifo< FifoSize >& edgeFifo, uint32_t vertex0, uint32_t vertex1, uint32_t vertex2 )
+{
+    uint64_t matches = 0;
 
-                verticesRead += 3;
-                newVertices  += 3;
+#if defined( MC_FIFO_AVX2 )
 
-                break;
-            }
+    __m256i key0 = _mm256_set1_epi32( static_cast< int >( vertex0 ) );
+    __m256i key1 = _mm256_set1_epi32( static_cast< int >( vertex1 ) );
+    __m256i key2 = _mm256_set1_epi32( static_cast< int >( vertex2 ) );
 
-            case IB_NEW_NEW_CACHED:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = reorderedTriangle[ 0 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 1 ];
+    for ( uint32_t slot = 0; slot < FifoSize; slot += 8 )
+    {
+        __m256i first  = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( edgeFifo.firsts + slot ) );
+        __m256i second = _mm256_loadu_si256( reinterpret_cast< const __m256i* >( edgeFifo.seconds + slot ) );
+        __m256i edge0  = _mm256_and_si256( _mm256_cmpeq_epi32( second, key0 ), _mm256_cmpeq_epi32( first, key1 ) );
+        __m256i edge1  = _mm256_and_si256( _mm256_cmpeq_epi32( second, key1 ), _mm256_cmpeq_epi32( first, key2 ) );
+        __m256i edge2  = _mm256_and_si256( _mm256_cmpeq_epi32( second, key2 ), _mm256_cmpeq_epi32( first, key0 ) );
+        __m256i equal  = _mm256_or_si256( _mm256_or_si256( edge0, edge1 ), edge2 );
+
+        matches |= static_cast< uint64_t >( _mm256_movemask_ps( _mm256_castsi256_ps( equal ) ) ) << slot;
+    }
 
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ], CachedVertexPrefixCodes );
+#else
 
-                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
-                vertexRemap[ reorderedTriangle[ 1 ] ] = newVertices + 1;
+    __m128i key0 = _mm_set1_epi32( static_cast< int >( vertex0 ) );
+    __m128i key1 = _mm_set1_epi32( static_cast< int >( vertex1 ) );
+    __m128i key2 = _mm_set1_epi32( static_cast< int >( vertex2 ) );
 
-                // encode vert 0 and 1 relative vert 2
-                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
-                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
-                const AttributeType*  vert2    = vertexAttributes + ( reorderedTriangle[ 2 ] * vertexAttributeCount );
-                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
-                const uint32_t*       k        = kArray;
+    for ( uint32_t slot = 0; slot < FifoSize; slot += 4 )
+    {
+        __m128i first  = _mm_loadu_si128( reinterpret_cast< const __m128i* >( edgeFifo.firsts + slot ) );
+        __m128i second = _mm_loadu_si128( reinterpret_cast< const __m128i* >( edgeFifo.seconds + slot ) );
+        __m128i edge0  = _mm_and_si128( _mm_cmpeq_epi32( second, key0 ), _mm_cmpeq_epi32( first, key1 ) );
+        __m128i edge1  = _mm_and_si128( _mm_cmpeq_epi32( second, key1 ), _mm_cmpeq_epi32( first, key2 ) );
+        __m128i edge2  = _mm_and_si128( _mm_cmpeq_epi32( second, key2 ), _mm_cmpeq_epi32( first, key0 ) );
+        __m128i equal  = _mm_or_si128( _mm_or_si128( edge0, edge1 ), edge2 );
+
+        matches |= static_cast< uint64_t >( _mm_movemask_ps( _mm_castsi128_ps( equal ) ) ) << slot;
+    }
+
+#endif
+
+    return matches;
+}
+
+// Index of the highest set bit in a non-zero FIFO bitmask.
+template < uint32_t FifoSize >
+static MC_INLINE uint32_t HighestBit( uint64_t bits )
+{
+    uint32_t high = static_cast< uint32_t >( bits >> 32 );
+
+    if ( FifoSize > 32 && high != 0 )
+    {
+        return 32 + WriteBitstream::Log2( high );
+    }
+
+    return WriteBitstream::Log2( static_cast< uint32_t >( bits ) );
+}
+
+// Given a non-zero bitmask of matching slots in a FIFO, where newestSlot was written last, find the relative position
+// (0 being the newest) of the most recent match.
+template < uint32_t FifoSize >
+static MC_INLINE uint32_t MostRecentMatch( uint64_t matches, uint32_t newestSlot )
+{
+    const uint64_t allSlots = ~uint64_t( 0 ) >> ( 64 - FifoSize );
+
+    // Rotate the newest slot up to the top bit, so the most recent match is the highest set bit.
+    uint32_t shift   = ( FifoSize - 1 ) - newestSlot;
+    uint64_t rotated = ( ( matches << shift ) | ( matches >> ( ( FifoSize - shift ) & ( FifoSize - 1 ) ) ) ) & allSlots;
+
+    return ( FifoSize - 1 ) - HighestBit< FifoSize >( rotated );
+}
+
+#endif // -- MC_FIFO_SIMD
+
+// Classify a vertex as new, cached or free, outputting the relative position in the vertex indice cache FIFO.
+template < uint32_t FifoSize >
+static MC_INLINE VertexClassification ClassifyVertex( uint32_t vertex, const uint32_t* vertexRemap, const uint32_t* vertexFifo, uint32_t verticesRead, uint32_t& cachedVertexIndex )
+{
+    if ( vertexRemap[ vertex ] == VERTEX_NOT_MAPPED )
+    {
+        return NEW_VERTEX;
+    }
+    else
+    {
+#if defined( MC_FIFO_SIMD )
+
+        // Vertices are only pushed when they are new or have left the FIFO, so there is at most one match.
+        uint64_t matches = MatchFifo< FifoSize >( vertexFifo, vertex );
+
+        if ( matches != 0 )
+        {
+            cachedVertexIndex = MostRecentMatch< FifoSize >( matches, ( verticesRead - 1 ) & ( FifoSize - 1 ) );
+
+            return CACHED_VERTEX;
+        }
+
+        return FREE_VERTEX;
+
+#else
+
+        int32_t lowestVertexCursor = verticesRead >= FifoSize ? verticesRead - FifoSize : 0;
+
+        // Probe backwards in the vertex FIFO for a cached vertex
+        for ( int32_t vertexCursor = verticesRead - 1; vertexCursor >= lowestVertexCursor; --vertexCursor )
+        {
+            if ( vertexFifo[ vertexCursor & ( FifoSize - 1 ) ] == vertex )
+            {
+                cachedVertexIndex = ( verticesRead - 1 ) - vertexCursor;
+
+                return CACHED_VERTEX;
+            }
+        }
+
+        return FREE_VERTEX;
+
+#endif
+    }
+}
+
+// The compressor's vertex FIFO. By default, cached vertices are found by comparing against the entries in the FIFO. With
+// a cursor table (MCF_VERTEX_CURSOR_TABLE), the cursor each vertex was last pushed at is kept instead, so whether a vertex
+// is cached and where is found in constant time, whatever the size of the FIFO. Both give exactly the same results.
+template < uint32_t FifoSize >
+class EncoderVertexFifo
+{
+public:
+
+    EncoderVertexFifo( uint32_t vertexCount, bool useCursorTable )
+        : m_cursors( useCursorTable ? new uint32_t[ vertexCount ] : NULL )
+    {
+        // FIFO entries that haven't been written yet must never match a vertex.
+        ::memset( m_fifo, 0xFF, sizeof( m_fifo ) );
+    }
+
+    ~EncoderVertexFifo()
+    {
+        delete[] m_cursors;
+    }
+
+    MC_INLINE void Push( uint32_t cursor, uint32_t vertex )
+    {
+        if ( m_cursors != NULL )
+        {
+            m_cursors[ vertex ] = cursor;
+        }
+        else
+        {
+            m_fifo[ cursor & ( FifoSize - 1 ) ] = vertex;
+        }
+    }
+
+    // Classify a vertex as new, cached or free, outputting the relative position in the FIFO for cached vertices.
+    MC_INLINE VertexClassification Classify( uint32_t vertex, const uint32_t* vertexRemap, uint32_t verticesRead, uint32_t& cachedVertexIndex ) const
+    {
+        if ( m_cursors == NULL )
+        {
+            return ClassifyVertex< FifoSize >( vertex, vertexRemap, m_fifo, verticesRead, cachedVertexIndex );
+        }
+
+        // Every vertex is pushed when it is first mapped, so mapped vertices always have a cursor.
+        if ( vertexRemap[ vertex ] == VERTEX_NOT_MAPPED )
+        {
+            return NEW_VERTEX;
+        }
+
+        uint32_t relativeVertex = ( verticesRead - 1 ) - m_cursors[ vertex ];
+
+        if ( relativeVertex < FifoSize )
+        {
+            cachedVertexIndex = relativeVertex;
+
+            return CACHED_VERTEX;
+        }
+
+        return FREE_VERTEX;
+    }
+
+private:
+
+    // Not copyable
+    EncoderVertexFifo( const EncoderVertexFifo& );
+
+    // Not assignable
+    EncoderVertexFifo& operator=( const EncoderVertexFifo& );
+
+    uint32_t  m_fifo[ FifoSize ];
+    uint32_t* m_cursors;
+};
+
+// Hash table from the directed half-edges of the triangles compressed so far to the triangle and edge they came from (as a
+// long edge reference, with the opposing vertex for parallelogram prediction), for finding shared edges that have left the edge
+// FIFO (MCF_LONG_EDGES). Open addressing with linear probing, kept under half full, where later triangles replace earlier ones.
+class EncoderHalfEdgeTable
+{
+public:
+
+    EncoderHalfEdgeTable( uint32_t triangleCount, bool enabled ) : m_entries( NULL ), m_mask( 0 ), m_shift( 64 )
+    {
+        if ( enabled )
+        {
+            uint64_t capacity = 16;
+
+            m_shift = 60;
+
+            while ( capacity < uint64_t( triangleCount ) * 6 )
+            {
+                capacity <<= 1;
+                --m_shift;
+            }
+
+            // Slots are 32 bit, so the table is limited to 2^31 entries (meshes of up to 357913941 triangles).
+            assert( capacity <= MAX_CAPACITY );
+
+            m_entries = new Entry[ static_cast< size_t >( capacity ) ];
+            m_mask    = static_cast< uint32_t >( capacity - 1 );
+
+            ::memset( m_entries, 0xFF, static_cast< size_t >( capacity ) * sizeof( Entry ) );
+        }
+    }
+
+    ~EncoderHalfEdgeTable()
+    {
+        delete[] m_entries;
+    }
+
+    MC_INLINE bool Enabled() const { return m_entries != NULL; }
+
+    // Add the edges of a triangle, with its vertices in the order they will be decompressed.
+    void InsertTriangle( uint32_t triangleIndex, uint32_t vertex0, uint32_t vertex1, uint32_t vertex2 )
+    {
+        Insert( vertex0, vertex1, vertex2, triangleIndex * 3 );
+        Insert( vertex1, vertex2, vertex0, triangleIndex * 3 + 1 );
+        Insert( vertex2, vertex0, vertex1, triangleIndex * 3 + 2 );
+    }
+
+    // Find the most recent edge running from first to second, outputting the opposing vertex and the triangle/edge it came from.
+    MC_INLINE bool Find( uint32_t first, uint32_t second, uint32_t& third, uint32_t& edgeIndex ) const
+    {
+        uint64_t key = Key( first, second );
+
+        for ( uint32_t slot = Hash( key ); m_entries[ slot ].key != EMPTY_KEY; slot = ( slot + 1 ) & m_mask )
+        {
+            if ( m_entries[ slot ].key == key )
+            {
+                third     = m_entries[ slot ].third;
+                edgeIndex = m_entries[ slot ].edgeIndex;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+
+    struct Entry
+    {
+        uint64_t key;
+        uint32_t third;
+        uint32_t edgeIndex;
+    };
+
+    static const uint64_t EMPTY_KEY    = ~uint64_t( 0 );
+    static const uint64_t MAX_CAPACITY = uint64_t( 1 ) << 31;
+
+    static MC_INLINE uint64_t Key( uint32_t first, uint32_t second ) { return ( uint64_t( first ) << 32 ) | second; }
+
+    // Fibonacci hashing, taking the top log2( capacity ) bits of the product.
+    MC_INLINE uint32_t Hash( uint64_t key ) const
+    {
+        return static_cast< uint32_t >( ( key * 0x9E3779B97F4A7C15ULL ) >> m_shift );
+    }
+
+    void Insert( uint32_t first, uint32_t second, uint32_t third, uint32_t edgeIndex )
+    {
+        uint64_t key  = Key( first, second );
+        uint32_t slot = Hash( key );
+
+        while ( m_entries[ slot ].key != EMPTY_KEY && m_entries[ slot ].key != key )
+        {
+            slot = ( slot + 1 ) & m_mask;
+        }
+
+        m_entries[ slot ].key       = key;
+        m_entries[ slot ].third     = third;
+        m_entries[ slot ].edgeIndex = edgeIndex;
+    }
+
+    // Not copyable
+    EncoderHalfEdgeTable( const EncoderHalfEdgeTable& );
+
+    // Not assignable
+    EncoderHalfEdgeTable& operator=( const EncoderHalfEdgeTable& );
+
+    Entry*   m_entries;
+    uint32_t m_mask;
+    uint32_t m_shift;
+};
+
+
+// Compress using triangle codes/prefix coding, with FifoSize entries in the edge and vertex FIFOs.
+template <uint32_t FifoSize, typename IndiceType, typename AttributeType, typename AttributeStreamsType, typename StatsType, typename OutputType>
+void CompressMeshFifo(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    OutputType& output,
+    AttributeStreamsType& attributeStreams,
+    StatsType& stats,
+    const MeshPrefixCodes& codes,
+    uint32_t flags,
+    uint32_t* attributeScratch )
+{
+    EncoderEdgeFifo< FifoSize >   edgeFifo;
+    EncoderVertexFifo< FifoSize > vertexFifo( vertexCount, ( flags & MCF_VERTEX_CURSOR_TABLE ) != 0 );
+    EncoderHalfEdgeTable          halfEdges( triangleCount, ( flags & MCF_LONG_EDGES ) != 0 );
+
+    uint32_t          edgesRead    = 0;
+    uint32_t          verticesRead = 0;
+    uint32_t          newVertices  = 0;
+    const IndiceType* triangleEnd  = triangles + ( triangleCount * 3 );
+    size_t            startBits    = output.Size();
+
+    assert( vertexCount < 0xFFFFFFFF );
+
+    uint32_t* vertexRemapEnd = vertexRemap + vertexCount;
+
+    // array of exponential moving average values to estimate optimal k for exp golomb codes
+    // note we use 16/16 unsigned fixed point. Meshes with more attributes than fit on the stack use the caller's scratch
+    // buffer or, failing that, one allocated for the duration of compression.
+    uint32_t  kInline[ MESH_INLINE_ATTRIBUTE_COUNT ];
+    bool      kOnStack   = vertexAttributeCount <= MESH_INLINE_ATTRIBUTE_COUNT;
+    uint32_t* kAllocated = !kOnStack && attributeScratch == NULL ? new uint32_t[ vertexAttributeCount ] : NULL;
+    uint32_t* kArray     = kOnStack ? kInline : ( attributeScratch != NULL ? attributeScratch : kAllocated );
+
+    for ( uint32_t vertexAttributeIndex = 0; vertexAttributeIndex < vertexAttributeCount; ++vertexAttributeIndex )
+    {
+        // prime the array of ks for exp golomb with an average bitsize of 4
+        // note that k is 
+        kArray[ vertexAttributeIndex ] = 4 << 16;
+    }
+
+    // The context for the next triangle code, with MCF_TRIANGLE_CONTEXTS.
+    uint32_t triangleContext = 0;
+
+    // With long edges, the oldest position in the edge FIFO is the escape code, so only the newer edges can be matched.
+    const uint32_t longEdgeEscape = LongEdgeEscape( FifoSize );
+    uint32_t       edgeFifoSize   = halfEdges.Enabled() ? longEdgeEscape : FifoSize;
+
+    // FIFO entries that haven't been written yet must never match a vertex.
+    edgeFifo.Initialise();
+
+    // clear the vertex remapping to "not found" value of 0xFFFFFFFF - dirty, but low overhead.
+    for ( uint32_t* remappedVertex = vertexRemap; remappedVertex < vertexRemapEnd; ++remappedVertex )
+    {
+        *remappedVertex = VERTEX_NOT_MAPPED;
+    }
+
+    // iterate through the triangles
+    for ( const IndiceType* triangle = triangles; triangle < triangleEnd; triangle += 3 )
+    {
+        int32_t lowestEdgeCursor = edgesRead >= edgeFifoSize ? edgesRead - edgeFifoSize : 0;
+        int32_t edgeCursor       = edgesRead - 1;
+        bool    foundEdge        = false;
+
+        int32_t spareVertex = 0;
+
+        // The edge used by an edge code, and the reference written after the escape when it's a long edge.
+        EdgeTriangle foundEdgeTriangle;
+        uint32_t     relativeEdge      = 0;
+        uint32_t     longEdgeReference = 0;
+        bool         longEdge          = false;
+
+        // check to make sure that there are no degenerate triangles.
+        assert( triangle[ 0 ] != triangle[ 1 ] && triangle[ 1 ] != triangle[ 2 ] && triangle[ 2 ] != triangle[ 0 ] );
+
+#if defined( MC_FIFO_SIMD )
+
+        // Well ordered meshes usually match one of the newest edges, so check those directly, then compare against the whole
+        // edge fifo at once and take the most recent match, checking the edges in the same order as probing would.
+        uint64_t edgeMatches = 0;
+
+        for ( int32_t newestEdgeCursor = edgeCursor - EDGE_FIFO_PROBE_COUNT; edgeCursor >= lowestEdgeCursor && edgeCursor > newestEdgeCursor; --edgeCursor )
+        {
+            const EdgeTriangle& edge = edgeFifo.Get( edgeCursor );
+
+            if ( ( edge.second == triangle[ 0 ] && edge.first == triangle[ 1 ] ) ||
+                 ( edge.second == triangle[ 1 ] && edge.first == triangle[ 2 ] ) ||
+                 ( edge.second == triangle[ 2 ] && edge.first == triangle[ 0 ] ) )
+            {
+                edgeMatches = 1;
+                break;
+            }
+        }
+
+        if ( edgeMatches == 0 && edgeCursor >= lowestEdgeCursor )
+        {
+            edgeMatches = MatchEdgeFifo( edgeFifo, triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+
+            if ( edgeFifoSize < FifoSize )
+            {
+                // the slot about to be overwritten is the oldest edge.
+                edgeMatches &= ~( uint64_t( 1 ) << ( edgesRead & ( FifoSize - 1 ) ) );
+            }
+
+            if ( edgeMatches != 0 )
+            {
+                edgeCursor = ( edgesRead - 1 ) - MostRecentMatch< FifoSize >( edgeMatches, ( edgesRead - 1 ) & ( FifoSize - 1 ) );
+            }
+        }
+
+        if ( edgeMatches != 0 )
+        {
+            foundEdge = true;
+
+            const EdgeTriangle& edge = edgeFifo.Get( edgeCursor );
+
+            if ( edge.second == triangle[ 0 ] && edge.first == triangle[ 1 ] )
+            {
+                spareVertex = 2;
+            }
+            else if ( edge.second == triangle[ 1 ] && edge.first == triangle[ 2 ] )
+            {
+                spareVertex = 0;
+            }
+            else
+            {
+                spareVertex = 1;
+            }
+        }
+
+#else
+
+        // Probe back through the edge fifo to see if one of the triangle edges is in the FIFO
+        for ( ; edgeCursor >= lowestEdgeCursor; --edgeCursor )
+        {
+            const EdgeTriangle& edge = edgeFifo.Get( edgeCursor );
+
+            // check all the edges in order and save the free vertex.
+            if ( edge.second == triangle[ 0 ] && edge.first == triangle[ 1 ] )
+            {
+                foundEdge   = true;
+                spareVertex = 2;
+                break;
+            }
+            else if ( edge.second == triangle[ 1 ] && edge.first == triangle[ 2 ] )
+            {
+                foundEdge   = true;
+                spareVertex = 0;
+                break;
+            }
+            else if ( edge.second == triangle[ 2 ] && edge.first == triangle[ 0 ] )
+            {
+                foundEdge   = true;
+                spareVertex = 1;
+                break;
+            }
+        }
+
+#endif
+
+        if ( foundEdge )
+        {
+            foundEdgeTriangle = edgeFifo.Get( edgeCursor );
+            relativeEdge      = ( edgesRead - 1 ) - edgeCursor;
+        }
+        else if ( halfEdges.Enabled() )
+        {
+            // Look for an edge that has left the FIFO. It's only worth the escape and reference if it gets a parallelogram
+            // prediction for a new vertex, or saves a free vertex on the edge.
+            for ( uint32_t edge = 0; edge < 3; ++edge )
+            {
+                uint32_t next     = edge == 2 ? 0 : edge + 1;
+                uint32_t opposite = next == 2 ? 0 : next + 1;
+                uint32_t third;
+                uint32_t edgeIndex;
+                uint32_t unused;
+
+                if ( halfEdges.Find( triangle[ next ], triangle[ edge ], third, edgeIndex ) &&
+                     ( vertexRemap[ triangle[ opposite ] ] == VERTEX_NOT_MAPPED ||
+                       vertexFifo.Classify( triangle[ edge ], vertexRemap, verticesRead, unused ) == FREE_VERTEX ||
+                       vertexFifo.Classify( triangle[ next ], vertexRemap, verticesRead, unused ) == FREE_VERTEX ) )
+                {
+                    uint32_t trianglesBack = static_cast< uint32_t >( ( triangle - triangles ) / 3 ) - ( edgeIndex / 3 );
+
+                    foundEdge         = true;
+                    longEdge          = true;
+                    spareVertex       = static_cast< int32_t >( opposite );
+                    relativeEdge      = longEdgeEscape;
+                    longEdgeReference = ( ( trianglesBack - 1 ) * 3 ) + ( edgeIndex % 3 );
+
+                    foundEdgeTriangle.set( triangle[ next ], triangle[ edge ], third );
+                    break;
+                }
+            }
+        }
+
+        // we found an edge so write it out, so classify a vertex and then write out the correct code.
+        if ( foundEdge )
+        {
+            uint32_t cachedVertex;
+
+            uint32_t             spareVertexIndice = triangle[ spareVertex ];
+            VertexClassification freeVertexClass   = vertexFifo.Classify( spareVertexIndice, vertexRemap, verticesRead, cachedVertex );
+
+            switch ( freeVertexClass )
+            {
+            case NEW_VERTEX:
+            {
+                WriteTriangleCode( output, stats, codes, triangleContext, IB_EDGE_NEW );
+                WriteEdge( output, stats, codes, relativeEdge );
+
+                if ( longEdge )
+                {
+                    WriteLongEdgeReference( output, stats, longEdgeReference );
+                }
+
+                vertexFifo.Push( verticesRead, spareVertexIndice );
+                vertexRemap[ spareVertexIndice ]              = newVertices;
+
+                const EdgeTriangle&  edge               = foundEdgeTriangle;
+                const AttributeType* adjacent1Attribute = vertexAttributes + ( edge.first * vertexAttributeCount );
+                const AttributeType* adjacent2Attribute = vertexAttributes + ( edge.second * vertexAttributeCount );
+                const AttributeType* opposingAttribute  = vertexAttributes + ( edge.third * vertexAttributeCount );
+                const AttributeType* vertexAttribute    = vertexAttributes + ( spareVertexIndice * vertexAttributeCount );
+                const AttributeType* endAttributes      = vertexAttribute + vertexAttributeCount;
+                uint32_t*            k                  = kArray;
+
+                for ( ; vertexAttribute < endAttributes; ++adjacent1Attribute, ++adjacent2Attribute, ++opposingAttribute, ++vertexAttribute, ++k )
+                {
+                    int32_t  predicted = int32_t( *adjacent2Attribute ) + ( int32_t( *adjacent1Attribute ) - int32_t( *opposingAttribute ) );
+                    int32_t  delta     = *vertexAttribute - predicted;
+                    uint32_t kEstimate = WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), delta, *k >> 16 );
+
+                    // fixed point exponential moving average with alpha 0.125 (equivalent to N being 31)
+                    *k = ( *k * 7 + ( kEstimate << 16 ) ) >> 3;
+                }
+
+                ++verticesRead;
+                ++newVertices;
+                break;
+            }
+            case CACHED_VERTEX:
+
+                WriteTriangleCode( output, stats, codes, triangleContext, IB_EDGE_CACHED );
+                WriteEdge( output, stats, codes, relativeEdge );
+
+                if ( longEdge )
+                {
+                    WriteLongEdgeReference( output, stats, longEdgeReference );
+                }
+                WriteCachedVertex( output, stats, codes, cachedVertex );
+
+                break;
+
+            case FREE_VERTEX:
+
+                WriteTriangleCode( output, stats, codes, triangleContext, IB_EDGE_FREE );
+                WriteEdge( output, stats, codes, relativeEdge );
+
+                if ( longEdge )
+                {
+                    WriteLongEdgeReference( output, stats, longEdgeReference );
+                }
+
+                vertexFifo.Push( verticesRead, spareVertexIndice );
+
+                ++verticesRead;
+
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ spareVertexIndice ] );
+
+                break;
+            }
+
+            // Populate the edge fifo with the remaining edges
+            // Note - the winding order is important as we'll need to re-produce this on decompression.
+            // The edges are put in as if the found edge is the first edge in the triangle (which it will be when we
+            // reconstruct).
+            switch ( spareVertex )
+            {
+            case 0:
+
+                edgeFifo.Set( edgesRead, triangle[ 2 ], triangle[ 0 ], triangle[ 1 ] );
+
+                ++edgesRead;
+
+                edgeFifo.Set( edgesRead, triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+
+                ++edgesRead;
+                break;
+
+            case 1:
+
+                edgeFifo.Set( edgesRead, triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+
+                ++edgesRead;
+
+                edgeFifo.Set( edgesRead, triangle[ 1 ], triangle[ 2 ], triangle[ 0 ] );
+
+                ++edgesRead;
+                break;
+
+            case 2:
+
+                edgeFifo.Set( edgesRead, triangle[ 1 ], triangle[ 2 ], triangle[ 0 ] );
+
+                ++edgesRead;
+
+                edgeFifo.Set( edgesRead, triangle[ 2 ], triangle[ 0 ], triangle[ 1 ] );
+
+                ++edgesRead;
+                break;
+            }
+
+            if ( halfEdges.Enabled() )
+            {
+                halfEdges.InsertTriangle( static_cast< uint32_t >( ( triangle - triangles ) / 3 ), foundEdgeTriangle.second, foundEdgeTriangle.first, spareVertexIndice );
+            }
+        }
+        else
+        {
+            VertexClassification classifications[ 3 ];
+            uint32_t             cachedVertexIndices[ 3 ];
+
+            // classify each vertex as new, cached or free, potentially extracting a cached indice.
+            classifications[ 0 ] = vertexFifo.Classify( triangle[ 0 ], vertexRemap, verticesRead, cachedVertexIndices[ 0 ] );
+            classifications[ 1 ] = vertexFifo.Classify( triangle[ 1 ], vertexRemap, verticesRead, cachedVertexIndices[ 1 ] );
+            classifications[ 2 ] = vertexFifo.Classify( triangle[ 2 ], vertexRemap, verticesRead, cachedVertexIndices[ 2 ] );
+
+            // use the classifications to lookup the matching compression code and potentially rotate the order of the vertices.
+            const VertexCompressionCase& compressionCase = CompressionCase[ classifications[ 0 ] ][ classifications[ 1 ] ][ classifications[ 2 ] ];
+
+            // rotate the order of the vertices based on the compression classification.
+            uint32_t reorderedTriangle[ 3 ];
+
+            reorderedTriangle[ 0 ] = triangle[ compressionCase.vertexOrder[ 0 ] ];
+            reorderedTriangle[ 1 ] = triangle[ compressionCase.vertexOrder[ 1 ] ];
+            reorderedTriangle[ 2 ] = triangle[ compressionCase.vertexOrder[ 2 ] ];
+
+            WriteTriangleCode( output, stats, codes, triangleContext, compressionCase.code );
+
+            switch ( compressionCase.code )
+            {
+            case IB_NEW_NEW_NEW:
+            {
+                vertexFifo.Push( verticesRead, triangle[ 0 ] );
+                vertexFifo.Push( verticesRead + 1, triangle[ 1 ] );
+                vertexFifo.Push( verticesRead + 2, triangle[ 2 ] );
+
+                vertexRemap[ triangle[ 0 ] ] = newVertices;
+                vertexRemap[ triangle[ 1 ] ] = newVertices + 1;
+                vertexRemap[ triangle[ 2 ] ] = newVertices + 2;
+
+                // interleaved verts
+                // encode vert 0 absolute
+                // encode vert 1 relative 0
+                // encode vert 2 relative 0
+
+                const AttributeType*  vert0    = vertexAttributes + ( triangle[ 0 ] * vertexAttributeCount );
+                const AttributeType*  vert1    = vertexAttributes + ( triangle[ 1 ] * vertexAttributeCount );
+                const AttributeType*  vert2    = vertexAttributes + ( triangle[ 2 ] * vertexAttributeCount );
+                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
+                const uint32_t*       k        = kArray;
+
+                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++vert2, ++k )
+                {
+                    int32_t readVert0  = *vert0;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), readVert0, EXP_GOLOMB_FIRST_NEW_K ); 
+
+                    int32_t deltaVert1 = *vert1 - readVert0;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert1, ( *k >> 16 ) );
+
+                    int32_t deltaVert2 = *vert2 - readVert0;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert2, ( *k >> 16 ) );
+                }
+
+                verticesRead += 3;
+                newVertices  += 3;
+
+                break;
+            }
+
+            case IB_NEW_NEW_CACHED:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 0 ] );
+                vertexFifo.Push( verticesRead + 1, reorderedTriangle[ 1 ] );
+
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ] );
+
+                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+                vertexRemap[ reorderedTriangle[ 1 ] ] = newVertices + 1;
+
+                // encode vert 0 and 1 relative vert 2
+                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
+                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
+                const AttributeType*  vert2    = vertexAttributes + ( reorderedTriangle[ 2 ] * vertexAttributeCount );
+                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
+                const uint32_t*       k        = kArray;
+
+                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++vert2, ++k )
+                {
+                    int32_t  readVert2 = *vert2;
+                    int32_t deltaVert0 = *vert0 - readVert2;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert0, ( *k >> 16 ) );
+
+                    int32_t deltaVert1 = *vert1 - readVert2;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert1, ( *k >> 16 ) );
+                }
+
+                verticesRead += 2;
+                newVertices  += 2;
+
+                break;
+            }
+
+            case IB_NEW_NEW_FREE:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 0 ] );
+                vertexFifo.Push( verticesRead + 1, reorderedTriangle[ 1 ] );
+                vertexFifo.Push( verticesRead + 2, reorderedTriangle[ 2 ] );
+
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+
+                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+                vertexRemap[ reorderedTriangle[ 1 ] ] = newVertices + 1;
+
+                // encode vert 0 and 1 relative vert 2
+                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
+                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
+                const AttributeType*  vert2    = vertexAttributes + ( reorderedTriangle[ 2 ] * vertexAttributeCount );
+                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
+                const uint32_t*       k        = kArray;
+
+                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++vert2, ++k )
+                {
+                    int32_t readVert2  = *vert2;
+                    int32_t deltaVert0 = *vert0 - readVert2;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert0, ( *k >> 16 ) );
+
+                    int32_t deltaVert1 = *vert1 - readVert2;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert1, ( *k >> 16 ) );
+                }
+
+                verticesRead += 3;
+                newVertices  += 2;
+
+                break;
+            }
+
+            case IB_NEW_CACHED_CACHED:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 0 ] );
+
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ] );
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ] );
+                
+                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+
+                // encode vert 0 relative vert 1
+                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
+                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
+                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
+                const uint32_t*       k        = kArray;
+                
+                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++k )
+                {
+                    int32_t readVert1  = *vert1;
+                    int32_t deltaVert0 = *vert0 - readVert1;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert0, ( *k >> 16 ) );
+                }
+
+                verticesRead += 1;
+                newVertices  += 1;
+
+                break;
+            }
+            case IB_NEW_CACHED_FREE:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 0 ] );
+                vertexFifo.Push( verticesRead + 1, reorderedTriangle[ 2 ] );
+
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ] );
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+
+                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+
+                // encode vert 0 relative vert 1
+                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
+                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
+                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
+                const uint32_t*       k        = kArray;
+
+                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++k )
+                {
+                    int32_t readVert1  = *vert1;
+                    int32_t deltaVert0 = *vert0 - readVert1;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert0, ( *k >> 16 ) );
+                }
+
+                verticesRead += 2;
+                newVertices  += 1;
+
+                break;
+            }
+            case IB_NEW_FREE_CACHED:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 0 ] );
+                vertexFifo.Push( verticesRead + 1, reorderedTriangle[ 1 ] );
+
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ] );
+
+                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+
+                // encode vert 0 relative vert 2
+                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
+                const AttributeType*  vert2    = vertexAttributes + ( reorderedTriangle[ 2 ] * vertexAttributeCount );
+                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
+                const uint32_t*       k        = kArray;
+
+                for ( ; vert0 < vert0End; ++vert0, ++vert2, ++k )
+                {
+                    int32_t readVert2  = *vert2;
+                    int32_t deltaVert0 = *vert0 - readVert2;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert0, ( *k >> 16 ) );
+                }
+
+                verticesRead += 2;
+                newVertices  += 1;
+
+                break;
+            }
+            case IB_NEW_FREE_FREE:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 0 ] );
+                vertexFifo.Push( verticesRead + 1, reorderedTriangle[ 1 ] );
+                vertexFifo.Push( verticesRead + 2, reorderedTriangle[ 2 ] );
+
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+
+                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+
+                // encode vert 0 relative vert 1
+                const AttributeType* vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
+                const AttributeType* vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
+                const AttributeType* vert0End = vert0 + vertexAttributeCount;
+                const uint32_t*      k        = kArray;
+
+                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++k )
+                {
+                    int32_t readVert1  = *vert1;
+                    int32_t deltaVert0 = *vert0 - readVert1;
+
+                    WriteAttribute( attributeStreams, stats, uint32_t( k - kArray ), deltaVert0, ( *k >> 16 ) );
+                }
+
+                verticesRead += 3;
+                newVertices  += 1;
+
+                break;
+            }
+            case IB_CACHED_CACHED_CACHED:
+            {
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 0 ] ] );
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ] );
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ] );
+
+                break;
+            }
+            case IB_CACHED_CACHED_FREE:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 2 ] );
+
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 0 ] ] );
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ] );
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+
+                verticesRead += 1;
+
+                break;
+            }
+            case IB_CACHED_FREE_FREE:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 1 ] );
+                vertexFifo.Push( verticesRead + 1, reorderedTriangle[ 2 ] );
+
+                WriteCachedVertex( output, stats, codes, cachedVertexIndices[ compressionCase.vertexOrder[ 0 ] ] );
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+
+                verticesRead += 2;
+
+                break;
+            }
+            case IB_FREE_FREE_FREE:
+            {
+                vertexFifo.Push( verticesRead, reorderedTriangle[ 0 ] );
+                vertexFifo.Push( verticesRead + 1, reorderedTriangle[ 1 ] );
+                vertexFifo.Push( verticesRead + 2, reorderedTriangle[ 2 ] );
+
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 0 ] ] );
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
+                WriteFreeVertex( output, stats, ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+
+                verticesRead += 3;
+                break;
+            }
+
+            default: // IB_EDGE_NEW, IB_EDGE_CACHED, IB_EDGE_0_NEW, IB_EDGE_1_NEW
+                break;
+            }
+
+            // populate the edge fifo with the 3 most recent edges
+            edgeFifo.Set( edgesRead, reorderedTriangle[ 0 ], reorderedTriangle[ 1 ], reorderedTriangle[ 2 ] );
+
+            ++edgesRead;
+
+            edgeFifo.Set( edgesRead, reorderedTriangle[ 1 ], reorderedTriangle[ 2 ], reorderedTriangle[ 0 ] );
+
+            ++edgesRead;
+
+            edgeFifo.Set( edgesRead, reorderedTriangle[ 2 ], reorderedTriangle[ 0 ], reorderedTriangle[ 1 ] );
+
+            ++edgesRead;
+
+            if ( halfEdges.Enabled() )
+            {
+                halfEdges.InsertTriangle( static_cast< uint32_t >( ( triangle - triangles ) / 3 ), reorderedTriangle[ 0 ], reorderedTriangle[ 1 ], reorderedTriangle[ 2 ] );
+            }
+        }
+    }
+
+    // Pad out the buffer to make sure we don't overflow when trying to read the bits for the last prefix code table lookup.
+    output.Write( 0, 32 );
+
+    stats.Finish( ( output.Size() - startBits ) + attributeStreams.SeparateBits() );
+
+    delete[] kAllocated;
+}
+
+// Build a length limited canonical prefix code from the count of each symbol and write its code lengths, for MCF_ADAPTIVE_CODES.
+template < typename OutputType >
+static void WriteAdaptiveCodes( OutputType& output, const uint32_t* counts, uint32_t symbolCount, uint32_t maximumCodeLength, PrefixCode* codes )
+{
+    uint8_t codeLengths[ MAX_PREFIX_CODE_SYMBOLS ];
+
+    BuildPrefixCodeLengths( counts, symbolCount, maximumCodeLength, codeLengths );
+    BuildPrefixCodes( codeLengths, symbolCount, codes );
+
+    for ( uint32_t symbol = 0; symbol < symbolCount; ++symbol )
+    {
+        output.Write( codeLengths[ symbol ], ADAPTIVE_CODE_LENGTH_BITS );
+    }
+}
+
+// Compress with the fixed prefix codes for the FIFO size or, with MCF_ADAPTIVE_CODES, codes built for this mesh (with a set of
+// triangle codes for each context with MCF_TRIANGLE_CONTEXTS). Those come from a first pass over the connectivity alone, as the
+// attributes don't change which triangle codes and FIFO positions are used.
+template <uint32_t FifoSize, typename IndiceType, typename AttributeType, typename AttributeStreamsType, typename StatsType, typename OutputType>
+void CompressMeshCodes(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    OutputType& output,
+    AttributeStreamsType& attributeStreams,
+    StatsType& stats,
+    uint32_t flags,
+    uint32_t* attributeScratch )
+{
+    MeshPrefixCodes codes = { TrianglePrefixCodes, FifoPrefixCodes< FifoSize >::Edges(), FifoPrefixCodes< FifoSize >::CachedVertices(), 0 };
+    PrefixCode      adaptiveCodes[ ( MESH_TRIANGLE_CODE_COUNT * MESH_TRIANGLE_CONTEXT_COUNT ) + ( FifoSize * 2 ) ];
+
+    if ( ( flags & ( MCF_ADAPTIVE_CODES | MCF_TRIANGLE_CONTEXTS ) ) != 0 )
+    {
+        MeshCompressionStats                             counts;
+        GatherContextCompressionStats                    countStats( counts );
+        CountingBitstream                                countOutput;
+        InterleavedAttributeStreams< CountingBitstream > countStreams( countOutput );
+
+        CompressMeshFifo< FifoSize >( triangles, triangleCount, vertexRemap, vertexCount, 0, vertexAttributes, countOutput, countStreams, countStats, codes, flags, NULL );
+
+        uint32_t    contextCount      = ( flags & MCF_TRIANGLE_CONTEXTS ) != 0 ? MESH_TRIANGLE_CONTEXT_COUNT : 1;
+        PrefixCode* edgeCodes         = adaptiveCodes + ( MESH_TRIANGLE_CODE_COUNT * contextCount );
+        PrefixCode* cachedVertexCodes = edgeCodes + FifoSize;
+
+        codes.triangles             = adaptiveCodes;
+        codes.edges                 = edgeCodes;
+        codes.cachedVertices        = cachedVertexCodes;
+        codes.triangleContextStride = contextCount > 1 ? MESH_TRIANGLE_CODE_COUNT : 0;
+
+        if ( contextCount > 1 )
+        {
+            for ( uint32_t context = 0; context < contextCount; ++context )
+            {
+                WriteAdaptiveCodes( output, countStats.contextTriangleCodes[ context ], MESH_TRIANGLE_CODE_COUNT, ADAPTIVE_TRIANGLE_MAX_CODE_LENGTH, adaptiveCodes + ( MESH_TRIANGLE_CODE_COUNT * context ) );
+            }
+        }
+        else
+        {
+            WriteAdaptiveCodes( output, counts.triangleCodes, MESH_TRIANGLE_CODE_COUNT, ADAPTIVE_TRIANGLE_MAX_CODE_LENGTH, adaptiveCodes );
+        }
+
+        WriteAdaptiveCodes( output, counts.edgeDistances, FifoSize, ADAPTIVE_EDGE_MAX_CODE_LENGTH, edgeCodes );
+        WriteAdaptiveCodes( output, counts.cachedVertexDistances, FifoSize, ADAPTIVE_VERTEX_MAX_CODE_LENGTH, cachedVertexCodes );
+    }
+
+    CompressMeshFifo< FifoSize >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, attributeStreams, stats, codes, flags, attributeScratch );
+}
+
+// Compress with the FIFO size from the flags.
+template <typename IndiceType, typename AttributeType, typename AttributeStreamsType, typename StatsType, typename OutputType>
+void CompressMesh(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    OutputType& output,
+    AttributeStreamsType& attributeStreams,
+    StatsType& stats,
+    uint32_t flags,
+    uint32_t* attributeScratch )
+{
+    switch ( MeshFifoSize( flags ) )
+    {
+    case 16:
+
+        CompressMeshCodes< 16 >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, attributeStreams, stats, flags, attributeScratch );
+        break;
+
+    case 64:
+
+        CompressMeshCodes< 64 >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, attributeStreams, stats, flags, attributeScratch );
+        break;
+
+    default:
+
+        CompressMeshCodes< 32 >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, attributeStreams, stats, flags, attributeScratch );
+        break;
+    }
+}
+
+// Compress with the attribute streams in the default interleaved format.
+template <typename IndiceType, typename AttributeType, typename StatsType, typename OutputType>
+void CompressMesh(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    OutputType& output,
+    StatsType& stats,
+    uint32_t flags = 0,
+    uint32_t* attributeScratch = NULL )
+{
+    InterleavedAttributeStreams< OutputType > attributeStreams( output );
+
+    CompressMesh< IndiceType, AttributeType >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, attributeStreams, stats, flags, attributeScratch );
+}
+
+// Split a zig-zag encoded residual into its rANS symbol and extra bits, for MCF_RANS_ATTRIBUTES.
+static MC_INLINE uint32_t RansResidualSymbol( uint32_t residual, uint32_t& extraBitCount )
+{
+    if ( residual < RANS_DIRECT_RESIDUALS )
+    {
+        extraBitCount = 0;
+
+        return residual;
+    }
+
+    uint32_t topBit = WriteBitstream::Log2( residual );
+
+    extraBitCount = topBit - 1;
+
+    return RANS_DIRECT_RESIDUALS + ( ( topBit - WriteBitstream::Log2( RANS_DIRECT_RESIDUALS ) ) << 1 ) + ( ( residual >> extraBitCount ) & 1 );
+}
+
+// Scale symbol counts to frequencies summing to 2^RANS_PROBABILITY_BITS, where every used symbol gets at least 1.
+static void NormaliseRansFrequencies( const uint32_t* counts, uint32_t total, uint32_t* frequencies )
+{
+    uint32_t frequencyTotal = 0;
+    uint32_t mostFrequent   = 0;
+
+    for ( uint32_t symbol = 0; symbol < RANS_RESIDUAL_SYMBOL_COUNT; ++symbol )
+    {
+        uint32_t frequency = static_cast< uint32_t >( ( static_cast< uint64_t >( counts[ symbol ] ) << RANS_PROBABILITY_BITS ) / total );
+
+        frequencies[ symbol ] = counts[ symbol ] > 0 && frequency == 0 ? 1 : frequency;
+        frequencyTotal       += frequencies[ symbol ];
+        mostFrequent          = counts[ symbol ] > counts[ mostFrequent ] ? symbol : mostFrequent;
+    }
+
+    // The most frequent symbol takes up the rounding, which always leaves it at least 1.
+    frequencies[ mostFrequent ] += ( 1 << RANS_PROBABILITY_BITS ) - frequencyTotal;
+
+    assert( static_cast< int32_t >( frequencies[ mostFrequent ] ) > 0 );
+}
+
+// Write zig-zag encoded residuals with static rANS, interleaved over RANS_LANE_COUNT coders, for MCF_RANS_ATTRIBUTES (see
+// MeshResidualCoding for the format).
+template < typename OutputType >
+static void WriteRansResiduals( OutputType& output, const uint32_t* residuals, uint32_t residualCount )
+{
+    uint32_t counts[ RANS_RESIDUAL_SYMBOL_COUNT ] = {};
+    uint32_t frequencies[ RANS_RESIDUAL_SYMBOL_COUNT ];
+    uint32_t cumulative[ RANS_RESIDUAL_SYMBOL_COUNT ];
+    uint8_t* symbols = new uint8_t[ residualCount + 1 ];
+
+    for ( uint32_t residual = 0; residual < residualCount; ++residual )
+    {
+        uint32_t extraBitCount;
+
+        symbols[ residual ] = static_cast< uint8_t >( RansResidualSymbol( residuals[ residual ], extraBitCount ) );
+
+        ++counts[ symbols[ residual ] ];
+    }
+
+    NormaliseRansFrequencies( counts, residualCount > 0 ? residualCount : 1, frequencies );
+
+    uint32_t symbolCount = 0;
+
+    for ( uint32_t symbol = 0, total = 0; symbol < RANS_RESIDUAL_SYMBOL_COUNT; ++symbol )
+    {
+        cumulative[ symbol ] = total;
+        total               += frequencies[ symbol ];
+        symbolCount          = frequencies[ symbol ] > 0 ? symbol + 1 : symbolCount;
+    }
+
+    // Encode backwards, so the decoder reads the words forwards. Each residual takes at most one renormalisation word.
+    uint16_t* words     = new uint16_t[ residualCount + RANS_LANE_COUNT * 2 ];
+    uint32_t  wordCount = 0;
+    uint32_t  states[ RANS_LANE_COUNT ];
+
+    for ( uint32_t lane = 0; lane < RANS_LANE_COUNT; ++lane )
+    {
+        states[ lane ] = RANS_STATE_LOWER_BOUND;
+    }
+
+    for ( uint32_t residual = residualCount; residual-- > 0; )
+    {
+        uint32_t& state     = states[ residual % RANS_LANE_COUNT ];
+        uint32_t  frequency = frequencies[ symbols[ residual ] ];
+
+        if ( state >= ( ( static_cast< uint64_t >( RANS_STATE_LOWER_BOUND ) >> RANS_PROBABILITY_BITS ) << 16 ) * frequency )
+        {
+            words[ wordCount++ ] = static_cast< uint16_t >( state );
+            state              >>= 16;
+        }
+
+        state = ( ( state / frequency ) << RANS_PROBABILITY_BITS ) + ( state % frequency ) + cumulative[ symbols[ residual ] ];
+    }
+
+    for ( uint32_t lane = RANS_LANE_COUNT; lane-- > 0; )
+    {
+        words[ wordCount++ ] = static_cast< uint16_t >( states[ lane ] >> 16 );
+        words[ wordCount++ ] = static_cast< uint16_t >( states[ lane ] );
+    }
+
+    uint32_t paddingWords = wordCount & 1;
+
+    output.Write( ( wordCount + paddingWords ) * 2, 32 );
+
+    for ( uint32_t word = wordCount; word-- > 0; )
+    {
+        output.Write( words[ word ], 16 );
+    }
+
+    output.Write( 0, paddingWords * 16 );
+    output.Write( symbolCount, RANS_SYMBOL_COUNT_BITS );
+
+    for ( uint32_t symbol = 0; symbol < symbolCount; ++symbol )
+    {
+        output.Write( frequencies[ symbol ] > 0, 1 );
+
+        if ( frequencies[ symbol ] > 0 )
+        {
+            output.Write( frequencies[ symbol ] - 1, RANS_PROBABILITY_BITS );
+        }
+    }
+
+    for ( uint32_t residual = 0; residual < residualCount; ++residual )
+    {
+        uint32_t extraBitCount;
+
+        RansResidualSymbol( residuals[ residual ], extraBitCount );
+
+        output.Write( residuals[ residual ] & ( ( uint32_t( 1 ) << extraBitCount ) - 1 ), extraBitCount );
+    }
+
+    delete[] words;
+    delete[] symbols;
+}
+
+// The number of vertices used by the mesh (the ones mapped to a decompressed vertex).
+static uint32_t CountMappedVertices( const uint32_t* vertexRemap, uint32_t vertexCount )
+{
+    uint32_t mappedVertexCount = 0;
+
+    for ( uint32_t vertex = 0; vertex < vertexCount; ++vertex )
+    {
+        mappedVertexCount += vertexRemap[ vertex ] != VERTEX_NOT_MAPPED;
+    }
+
+    return mappedVertexCount;
+}
+
+// The number of vertices used by the triangles, marking them in the vertex remap (which compression then overwrites).
+template < typename IndiceType >
+static uint32_t CountUsedVertices( const IndiceType* triangles, uint32_t triangleCount, uint32_t* vertexRemap, uint32_t vertexCount )
+{
+    const IndiceType* triangleEnd = triangles + ( static_cast< size_t >( triangleCount ) * 3 );
+
+    for ( uint32_t vertex = 0; vertex < vertexCount; ++vertex )
+    {
+        vertexRemap[ vertex ] = VERTEX_NOT_MAPPED;
+    }
+
+    for ( const IndiceType* indice = triangles; indice < triangleEnd; ++indice )
+    {
+        vertexRemap[ *indice ] = 0;
+    }
+
+    return CountMappedVertices( vertexRemap, vertexCount );
+}
+
+// The flags recorded in MCF_MESH_HEADER, describing the format actually written: rANS only applies to separate streams, and
+// MCF_TRIANGLE_CONTEXTS implies MCF_ADAPTIVE_CODES.
+static uint32_t MeshHeaderFlags( uint32_t flags )
+{
+    uint32_t formatFlags = flags & ( MCF_FORMAT_FLAGS | MCF_SEPARATE_STREAMS );
+
+    if ( ( formatFlags & MCF_SEPARATE_STREAMS ) == 0 )
+    {
+        formatFlags &= ~MCF_RANS_ATTRIBUTES;
+    }
+
+    if ( ( formatFlags & MCF_TRIANGLE_CONTEXTS ) != 0 )
+    {
+        formatFlags |= MCF_ADAPTIVE_CODES;
+    }
+
+    return formatFlags;
+}
+
+// Compress with the connectivity and each attribute column in separate streams, which are put together behind a table of offsets.
+template <typename IndiceType, typename AttributeType, typename StatsType, typename OutputType>
+void CompressMeshSeparate(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    OutputType& output,
+    StatsType& stats,
+    uint32_t flags,
+    uint32_t* attributeScratch )
+{
+    assert( ( output.Size() & 7 ) == 0 );
+
+    bool                                   rans           = ( flags & MCF_RANS_ATTRIBUTES ) != 0;
+    OutputType                             topology( 64 * 1024 );
+    OutputType*                            columns        = new OutputType[ vertexAttributeCount ];
+    uint32_t*                              residuals      = rans ? new uint32_t[ static_cast< size_t >( vertexCount ) * vertexAttributeCount ] : NULL;
+    uint32_t*                              residualCounts = rans ? new uint32_t[ vertexAttributeCount ] : NULL;
+    SeparateAttributeStreams< OutputType > attributeStreams( columns, vertexAttributeCount, residuals, vertexCount, residualCounts );
+
+    if ( rans )
+    {
+        ::memset( residualCounts, 0, sizeof( uint32_t ) * vertexAttributeCount );
+    }
+
+    CompressMesh< IndiceType, AttributeType >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, topology, attributeStreams, stats, flags, attributeScratch );
+
+    uint32_t usedVertexCount = CountMappedVertices( vertexRemap, vertexCount );
+
+    topology.AlignToByte();
+    topology.Finish();
+
+    uint32_t offset = static_cast< uint32_t >( ( MESH_SEPARATE_HEADER_WORDS + vertexAttributeCount ) * 4 + topology.ByteSize() );
+
+    output.Write( usedVertexCount, 32 );
+    output.Write( vertexAttributeCount, 32 );
+    output.Write( flags & MCF_FORMAT_FLAGS, 32 );
+
+    // With MCF_RANS_ATTRIBUTES, each column is also rANS coded and the smaller of the two is used.
+    OutputType*     ransColumns   = rans ? new OutputType[ vertexAttributeCount ] : NULL;
+    uint32_t*       columnCodings = rans ? new uint32_t[ vertexAttributeCount ] : NULL;
+
+    for ( uint32_t column = 0; column < vertexAttributeCount; ++column )
+    {
+        size_t columnBits = columns[ column ].Size();
+
+        // Pad each column out, the same as the connectivity.
+        columns[ column ].Write( 0, 32 );
+        columns[ column ].AlignToByte();
+        columns[ column ].Finish();
+
+        size_t columnBytes = columns[ column ].ByteSize();
+
+        if ( rans )
+        {
+            OutputType& ransColumn = ransColumns[ column ];
+
+            WriteRansResiduals( ransColumn, residuals + static_cast< size_t >( column ) * vertexCount, residualCounts[ column ] );
+
+            size_t ransBits = ransColumn.Size();
+
+            // The bitstream at the end can be shorter than the 8 bytes ReadBitstream starts with, so it gets 64 bits of padding.
+            ransColumn.Write( 0, 32 );
+            ransColumn.Write( 0, 32 );
+            ransColumn.AlignToByte();
+            ransColumn.Finish();
+
+            columnCodings[ column ] = ransColumn.ByteSize() < columnBytes ? MRC_RANS : MRC_UNIVERSAL;
+
+            if ( columnCodings[ column ] == MRC_RANS )
+            {
+                stats.RecodeAttribute( column, columnBits, ransBits );
+
+                columnBytes = ransColumn.ByteSize();
+            }
+
+            columnBytes += 4;
+        }
+
+        output.Write( offset, 32 );
+
+        offset += static_cast< uint32_t >( columnBytes );
+    }
+
+    output.Append( topology );
+
+    for ( uint32_t column = 0; column < vertexAttributeCount; ++column )
+    {
+        if ( rans )
+        {
+            output.Write( columnCodings[ column ], 32 );
+        }
+
+        output.Append( rans && columnCodings[ column ] == MRC_RANS ? ransColumns[ column ] : columns[ column ] );
+    }
+
+    delete[] columnCodings;
+    delete[] ransColumns;
+    delete[] residualCounts;
+    delete[] residuals;
+    delete[] columns;
+}
+
+// Compress with the options given.
+template <typename IndiceType, typename AttributeType, typename StatsType, typename OutputType>
+void CompressMeshWithOptions(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    OutputType& output,
+    const MeshCompressionOptions& options,
+    StatsType& stats )
+{
+    if ( ( options.flags & MCF_MESH_HEADER ) != 0 )
+    {
+        assert( ( output.Size() & 7 ) == 0 );
+
+        // The header goes straight out ahead of the mesh (so streamed output never has to hold the whole mesh), with the vertex
+        // count from the vertices the triangles use, which are the ones the compressor maps.
+        MeshCompressionOptions meshOptions = options;
+
+        meshOptions.flags &= ~MCF_MESH_HEADER;
+
+        output.Write( MESH_HEADER_MAGIC, 32 );
+        output.Write( MESH_HEADER_VERSION, 32 );
+        output.Write( static_cast< uint32_t >( sizeof( IndiceType ) | ( sizeof( AttributeType ) << 8 ) ), 32 );
+        output.Write( triangleCount, 32 );
+        output.Write( CountUsedVertices( triangles, triangleCount, vertexRemap, vertexCount ), 32 );
+        output.Write( vertexAttributeCount, 32 );
+        output.Write( MeshHeaderFlags( options.flags ), 32 );
+
+        CompressMeshWithOptions< IndiceType, AttributeType >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, meshOptions, stats );
+        return;
+    }
+
+    if ( ( options.flags & MCF_SEPARATE_STREAMS ) != 0 )
+    {
+        CompressMeshSeparate< IndiceType, AttributeType >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, stats, options.flags, options.attributeScratch );
+    }
+    else
+    {
+        CompressMesh< IndiceType, AttributeType >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, stats, options.flags, options.attributeScratch );
+    }
+}
+
+template <typename IndiceType, typename AttributeType, typename OutputType>
+void CompressMeshWithOptions(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    OutputType& output,
+    const MeshCompressionOptions& options )
+{
+    if ( options.stats != NULL )
+    {
+        GatherCompressionStats stats( *options.stats );
+
+        CompressMeshWithOptions< IndiceType, AttributeType >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options, stats );
+    }
+    else
+    {
+        NullCompressionStats stats;
+
+        CompressMeshWithOptions< IndiceType, AttributeType >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options, stats );
+    }
+}
+
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output )
+{
+    NullCompressionStats stats;
+
+    CompressMesh< uint16_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, stats );
+}
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output )
+{
+    NullCompressionStats stats;
+
+    CompressMesh< uint32_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, stats );
+}
+
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output )
+{
+    NullCompressionStats stats;
+
+    CompressMesh< uint16_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, stats );
+}
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output )
+{
+    NullCompressionStats stats;
+
+    CompressMesh< uint32_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, stats );
+}
+
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats )
+{
+    GatherCompressionStats gatherStats( stats );
+
+    CompressMesh< uint16_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, gatherStats );
+}
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats )
+{
+    GatherCompressionStats gatherStats( stats );
+
+    CompressMesh< uint32_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, gatherStats );
+}
+
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats )
+{
+    GatherCompressionStats gatherStats( stats );
+
+    CompressMesh< uint16_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, gatherStats );
+}
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats )
+{
+    GatherCompressionStats gatherStats( stats );
 
-                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++vert2, ++k )
-                {
-                    int32_t  readVert2 = *vert2;
-                    int32_t deltaVert0 = *vert0 - readVert2;
+    CompressMesh< uint32_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, gatherStats );
+}
 
-                    output.WriteUniversalZigZag( deltaVert0, ( *k >> 16 ) );
 
-                    int32_t deltaVert1 = *vert1 - readVert2;
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint16_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-                    output.WriteUniversalZigZag( deltaVert1, ( *k >> 16 ) );
-                }
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint32_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-                verticesRead += 2;
-                newVertices  += 2;
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint16_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-                break;
-            }
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint32_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-            case IB_NEW_NEW_FREE:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = reorderedTriangle[ 0 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 1 ];
-                vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 2 ];
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint16_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint32_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
-                vertexRemap[ reorderedTriangle[ 1 ] ] = newVertices + 1;
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint16_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-                // encode vert 0 and 1 relative vert 2
-                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
-                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
-                const AttributeType*  vert2    = vertexAttributes + ( reorderedTriangle[ 2 ] * vertexAttributeCount );
-                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
-                const uint32_t*       k        = kArray;
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options )
+{
+    CompressMeshWithOptions< uint32_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output, options );
+}
 
-                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++vert2, ++k )
-                {
-                    int32_t readVert2  = *vert2;
-                    int32_t deltaVert0 = *vert0 - readVert2;
+// The most bits WriteVInt takes for values up to maximum.
+static uint64_t VIntBitsBound( uint64_t maximum )
+{
+    uint64_t bytes = 1;
 
-                    output.WriteUniversalZigZag( deltaVert0, ( *k >> 16 ) );
+    while ( ( maximum >>= 7 ) > 0 )
+    {
+        ++bytes;
+    }
 
-                    int32_t deltaVert1 = *vert1 - readVert2;
+    return bytes * 8;
+}
 
-                    output.WriteUniversalZigZag( deltaVert1, ( *k >> 16 ) );
-                }
+size_t CompressMeshBound( uint32_t triangleCount, uint32_t vertexCount, uint32_t vertexAttributeCount, uint32_t attributeSize, uint32_t flags )
+{
+    assert( attributeSize == sizeof( int16_t ) || attributeSize == sizeof( int32_t ) );
 
-                verticesRead += 3;
-                newVertices  += 2;
+    uint32_t fifoSize    = MeshFifoSize( flags );
+    uint64_t newVertices = vertexCount < static_cast< uint64_t >( triangleCount ) * 3 ? vertexCount : static_cast< uint64_t >( triangleCount ) * 3;
 
-                break;
-            }
+    // Every prefix code fits in LONGEST_PREFIX_CODE bits, free vertices are relative to the newest vertex and long edge
+    // references are to one of the earlier triangles' edges.
+    uint64_t vertexBits   = VIntBitsBound( vertexCount > 0 ? vertexCount - 1 : 0 );
+    uint64_t longEdgeBits = ( flags & MCF_LONG_EDGES ) != 0 ? VIntBitsBound( static_cast< uint64_t >( triangleCount ) * 3 ) : 0;
 
-            case IB_NEW_CACHED_CACHED:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ] = reorderedTriangle[ 0 ];
+    if ( vertexBits < LONGEST_PREFIX_CODE )
+    {
+        vertexBits = LONGEST_PREFIX_CODE;
+    }
 
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ], CachedVertexPrefixCodes );
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ], CachedVertexPrefixCodes );
-                
-                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+    // A triangle is either 3 new, cached or free vertices, or an edge (possibly long) followed by one of them.
+    uint64_t vertexTriangleBits = vertexBits * 3;
+    uint64_t edgeTriangleBits   = LONGEST_PREFIX_CODE + longEdgeBits + vertexBits;
+    uint64_t triangleBits       = LONGEST_PREFIX_CODE + ( vertexTriangleBits > edgeTriangleBits ? vertexTriangleBits : edgeTriangleBits );
+    uint64_t topologyBits       = triangleBits * triangleCount + 32;
 
-                // encode vert 0 relative vert 1
-                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
-                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
-                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
-                const uint32_t*       k        = kArray;
-                
-                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++k )
-                {
-                    int32_t readVert1  = *vert1;
-                    int32_t deltaVert0 = *vert0 - readVert1;
+    if ( ( flags & ( MCF_ADAPTIVE_CODES | MCF_TRIANGLE_CONTEXTS ) ) != 0 )
+    {
+        uint32_t contextCount = ( flags & MCF_TRIANGLE_CONTEXTS ) != 0 ? MESH_TRIANGLE_CONTEXT_COUNT : 1;
 
-                    output.WriteUniversalZigZag( deltaVert0, ( *k >> 16 ) );
-                }
+        topologyBits += static_cast< uint64_t >( ( MESH_TRIANGLE_CODE_COUNT * contextCount ) + ( fifoSize * 2 ) ) * ADAPTIVE_CODE_LENGTH_BITS;
+    }
 
-                verticesRead += 1;
-                newVertices  += 1;
+    // Residuals are the difference from a prediction of up to 3 attributes, so they take at most 2 bits more than the attribute
+    // (and the universal coder only takes them below 2^31). The longest universal code for a value of n significant bits is
+    // 2n bits with k of 0, while the first vertex of a NEW_NEW_NEW triangle always uses EXP_GOLOMB_FIRST_NEW_K.
+    uint64_t residualBits = attributeSize * 8 + 2 < 31 ? attributeSize * 8 + 2 : 31;
 
-                break;
-            }
-            case IB_NEW_CACHED_FREE:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = reorderedTriangle[ 0 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 2 ];
+    residualBits = residualBits * 2 > EXP_GOLOMB_FIRST_NEW_K + 1 ? residualBits * 2 : EXP_GOLOMB_FIRST_NEW_K + 1;
 
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ], CachedVertexPrefixCodes );
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+    uint64_t columnBits = newVertices * residualBits;
+    uint64_t bytes;
 
-                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+    if ( ( flags & MCF_SEPARATE_STREAMS ) != 0 )
+    {
+        // Each stream is padded and byte aligned, and rANS coding is only used for a column when it's smaller.
+        uint64_t columnBytes = ( columnBits + 32 + 7 ) / 8 + ( ( flags & MCF_RANS_ATTRIBUTES ) != 0 ? 4 : 0 );
 
-                // encode vert 0 relative vert 1
-                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
-                const AttributeType*  vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
-                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
-                const uint32_t*       k        = kArray;
+        bytes = static_cast< uint64_t >( MESH_SEPARATE_HEADER_WORDS + vertexAttributeCount ) * 4 + ( topologyBits + 7 ) / 8 + columnBytes * vertexAttributeCount;
+    }
+    else
+    {
+        bytes = ( topologyBits + columnBits * vertexAttributeCount + 7 ) / 8;
+    }
 
-                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++k )
-                {
-                    int32_t readVert1  = *vert1;
-                    int32_t deltaVert0 = *vert0 - readVert1;
+    if ( ( flags & MCF_MESH_HEADER ) != 0 )
+    {
+        bytes += MESH_HEADER_WORDS * 4;
+    }
 
-                    output.WriteUniversalZigZag( deltaVert0, ( *k >> 16 ) );
-                }
+    // WriteBitstream writes whole 64 bit words, with Finish always writing one more.
+    return static_cast< size_t >( ( ( bytes + 7 ) / 8 + 1 ) * 8 );
+}
 
-                verticesRead += 2;
-                newVertices  += 1;
+// A chunk of a chunked mesh, compressed separately.
+struct CompressedMeshChunk
+{
+    CompressedMeshChunk() : vertexSources( NULL ), vertexCount( 0 ), output( 4096 ) {}
 
-                break;
-            }
-            case IB_NEW_FREE_CACHED:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = reorderedTriangle[ 0 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 1 ];
+    ~CompressedMeshChunk() { delete[] vertexSources; }
 
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ], CachedVertexPrefixCodes );
+    // The chunk's triangles, with indices local to the chunk (in order of first use).
+    const uint32_t* triangles;
+    uint32_t        triangleCount;
 
-                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+    // The source vertex for each local vertex, re-ordered to the decompressed vertex order once the chunk is compressed.
+    uint32_t*       vertexSources;
+    uint32_t        vertexCount;
 
-                // encode vert 0 relative vert 2
-                const AttributeType*  vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
-                const AttributeType*  vert2    = vertexAttributes + ( reorderedTriangle[ 2 ] * vertexAttributeCount );
-                const AttributeType*  vert0End = vert0 + vertexAttributeCount;
-                const uint32_t*       k        = kArray;
+    WriteBitstream  output;
+};
 
-                for ( ; vert0 < vert0End; ++vert0, ++vert2, ++k )
-                {
-                    int32_t readVert2  = *vert2;
-                    int32_t deltaVert0 = *vert0 - readVert2;
+// Compress a single chunk, called from RunParallel.
+template < typename AttributeType >
+struct CompressMeshChunkJob
+{
+    void operator()( uint32_t chunkIndex )
+    {
+        CompressedMeshChunk& chunk            = chunks[ chunkIndex ];
+        AttributeType*       chunkAttributes  = new AttributeType[ chunk.vertexCount * vertexAttributeCount ];
+        uint32_t*            chunkVertexRemap = new uint32_t[ chunk.vertexCount ];
+        uint32_t*            vertexSources    = new uint32_t[ chunk.vertexCount ];
+        NullCompressionStats stats;
 
-                    output.WriteUniversalZigZag( deltaVert0, ( *k >> 16 ) );
-                }
+        for ( uint32_t vertex = 0; vertex < chunk.vertexCount; ++vertex )
+        {
+            ::memcpy( chunkAttributes + ( vertex * vertexAttributeCount ),
+                      vertexAttributes + ( chunk.vertexSources[ vertex ] * vertexAttributeCount ),
+                      vertexAttributeCount * sizeof( AttributeType ) );
+        }
 
-                verticesRead += 2;
-                newVertices  += 1;
+        CompressMesh< uint32_t, AttributeType >( chunk.triangles, chunk.triangleCount, chunkVertexRemap, chunk.vertexCount, vertexAttributeCount, chunkAttributes, chunk.output, stats );
 
-                break;
-            }
-            case IB_NEW_FREE_FREE:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = reorderedTriangle[ 0 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 1 ];
-                vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 2 ];
+        chunk.output.AlignToByte();
+        chunk.output.Finish();
 
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+        // Every vertex in the chunk is used, so the remap is a permutation.
+        for ( uint32_t vertex = 0; vertex < chunk.vertexCount; ++vertex )
+        {
+            vertexSources[ chunkVertexRemap[ vertex ] ] = chunk.vertexSources[ vertex ];
+        }
 
-                vertexRemap[ reorderedTriangle[ 0 ] ] = newVertices;
+        delete[] chunk.vertexSources;
+        delete[] chunkVertexRemap;
+        delete[] chunkAttributes;
 
-                // encode vert 0 relative vert 1
-                const AttributeType* vert0    = vertexAttributes + ( reorderedTriangle[ 0 ] * vertexAttributeCount );
-                const AttributeType* vert1    = vertexAttributes + ( reorderedTriangle[ 1 ] * vertexAttributeCount );
-                const AttributeType* vert0End = vert0 + vertexAttributeCount;
-                const uint32_t*      k        = kArray;
+        chunk.vertexSources = vertexSources;
+    }
 
-                for ( ; vert0 < vert0End; ++vert0, ++vert1, ++k )
-                {
-                    int32_t readVert1  = *vert1;
-                    int32_t deltaVert0 = *vert0 - readVert1;
+    CompressedMeshChunk* chunks;
+    uint32_t             vertexAttributeCount;
+    const AttributeType* vertexAttributes;
+};
 
-                    output.WriteUniversalZigZag( deltaVert0, ( *k >> 16 ) );
-                }
+template < typename IndiceType, typename AttributeType >
+uint32_t CompressMeshChunked(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const AttributeType* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
+    WriteBitstream& output )
+{
+    assert( trianglesPerChunk > 0 );
+    assert( ( output.Size() & 7 ) == 0 );
 
-                verticesRead += 3;
-                newVertices  += 1;
+    uint32_t             chunkCount     = ( triangleCount + trianglesPerChunk - 1 ) / trianglesPerChunk;
+    CompressedMeshChunk* chunks         = new CompressedMeshChunk[ chunkCount ];
+    uint32_t*            chunkTriangles = new uint32_t[ triangleCount * 3 ];
+    uint32_t*            localVertices  = new uint32_t[ vertexCount ];
+    uint32_t*            vertexChunks   = new uint32_t[ vertexCount ];
 
-                break;
-            }
-            case IB_CACHED_CACHED_CACHED:
-            {
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 0 ] ], CachedVertexPrefixCodes );
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ], CachedVertexPrefixCodes );
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 2 ] ], CachedVertexPrefixCodes );
+    // Vertices are mapped to each chunk in order of first use, with vertexChunks marking which chunk localVertices is valid for.
+    ::memset( vertexChunks, 0xFF, vertexCount * sizeof( uint32_t ) );
 
-                break;
-            }
-            case IB_CACHED_CACHED_FREE:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ] = reorderedTriangle[ 2 ];
+    for ( uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
+    {
+        CompressedMeshChunk& chunk         = chunks[ chunkIndex ];
+        uint32_t             firstTriangle = chunkIndex * trianglesPerChunk;
+        uint32_t             indiceStart   = firstTriangle * 3;
+        uint32_t             indiceEnd     = ( firstTriangle + trianglesPerChunk < triangleCount ? firstTriangle + trianglesPerChunk : triangleCount ) * 3;
 
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 0 ] ], CachedVertexPrefixCodes );
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 1 ] ], CachedVertexPrefixCodes );
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+        chunk.triangles     = chunkTriangles + indiceStart;
+        chunk.triangleCount = ( indiceEnd - indiceStart ) / 3;
+        chunk.vertexSources = new uint32_t[ indiceEnd - indiceStart ];
 
-                verticesRead += 1;
+        for ( uint32_t indice = indiceStart; indice < indiceEnd; ++indice )
+        {
+            uint32_t vertex = triangles[ indice ];
 
-                break;
-            }
-            case IB_CACHED_FREE_FREE:
+            if ( vertexChunks[ vertex ] != chunkIndex )
             {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = reorderedTriangle[ 1 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 2 ];
+                vertexChunks[ vertex ]                     = chunkIndex;
+                localVertices[ vertex ]                    = chunk.vertexCount;
+                chunk.vertexSources[ chunk.vertexCount++ ] = vertex;
+            }
 
-                output.WritePrefixCode( cachedVertexIndices[ compressionCase.vertexOrder[ 0 ] ], CachedVertexPrefixCodes );
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+            chunkTriangles[ indice ] = localVertices[ vertex ];
+        }
+    }
 
-                verticesRead += 2;
+    delete[] vertexChunks;
+    delete[] localVertices;
 
-                break;
-            }
-            case IB_FREE_FREE_FREE:
-            {
-                vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         = reorderedTriangle[ 0 ];
-                vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 1 ];
-                vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] = reorderedTriangle[ 2 ];
+    CompressMeshChunkJob< AttributeType > job;
 
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 0 ] ] );
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 1 ] ] );
-                output.WriteVInt( ( newVertices - 1 ) - vertexRemap[ reorderedTriangle[ 2 ] ] );
+    job.chunks               = chunks;
+    job.vertexAttributeCount = vertexAttributeCount;
+    job.vertexAttributes     = vertexAttributes;
 
-                verticesRead += 3;
-                break;
-            }
+    RunParallel( chunkCount, threadCount, job );
 
-            default: // IB_EDGE_NEW, IB_EDGE_CACHED, IB_EDGE_0_NEW, IB_EDGE_1_NEW
-                break;
-            }
+    // Write out the chunk table, followed by the chunks.
+    uint32_t chunkOffset = ( MESH_CHUNK_HEADER_WORDS + ( chunkCount * MESH_CHUNK_WORDS_PER_CHUNK ) ) * 4;
+    uint32_t firstVertex = 0;
 
-            // populate the edge fifo with the 3 most recent edges
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( reorderedTriangle[ 0 ], reorderedTriangle[ 1 ], reorderedTriangle[ 2 ] );
+    for ( uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
+    {
+        firstVertex += chunks[ chunkIndex ].vertexCount;
+    }
 
-            ++edgesRead;
+    output.Write( trianglesPerChunk, 32 );
+    output.Write( chunkCount, 32 );
+    output.Write( firstVertex, 32 );
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( reorderedTriangle[ 1 ], reorderedTriangle[ 2 ], reorderedTriangle[ 0 ] );
+    firstVertex = 0;
 
-            ++edgesRead;
+    for ( uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
+    {
+        const CompressedMeshChunk& chunk = chunks[ chunkIndex ];
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( reorderedTriangle[ 2 ], reorderedTriangle[ 0 ], reorderedTriangle[ 1 ] );
+        output.Write( chunkOffset, 32 );
+        output.Write( firstVertex, 32 );
 
-            ++edgesRead;
-        }
+        ::memcpy( vertexSources + firstVertex, chunk.vertexSources, chunk.vertexCount * sizeof( uint32_t ) );
+
+        chunkOffset += static_cast< uint32_t >( chunk.output.Size() >> 3 );
+        firstVertex += chunk.vertexCount;
     }
 
-    // Pad out the buffer to make sure we don't overflow when trying to read the bits for the last prefix code table lookup.
-    output.Write( 0, 32 );
+    for ( uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
+    {
+        output.Append( chunks[ chunkIndex ].output );
+    }
+
+    delete[] chunkTriangles;
+    delete[] chunks;
+
+    return firstVertex;
 }
 
-void CompressMesh(
+uint32_t CompressMeshChunked(
     const uint16_t* triangles,
     uint32_t triangleCount,
-    uint32_t* vertexRemap,
     uint32_t vertexCount,
     uint32_t vertexAttributeCount,
     const int32_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
     WriteBitstream& output )
 {
-    CompressMesh< uint16_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output );
+    return CompressMeshChunked< uint16_t, int32_t >( triangles, triangleCount, vertexCount, vertexAttributeCount, vertexAttributes, trianglesPerChunk, threadCount, vertexSources, output );
 }
 
-void CompressMesh(
+uint32_t CompressMeshChunked(
     const uint32_t* triangles,
     uint32_t triangleCount,
-    uint32_t* vertexRemap,
     uint32_t vertexCount,
     uint32_t vertexAttributeCount,
     const int32_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
     WriteBitstream& output )
 {
-    CompressMesh< uint32_t, int32_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output );
+    return CompressMeshChunked< uint32_t, int32_t >( triangles, triangleCount, vertexCount, vertexAttributeCount, vertexAttributes, trianglesPerChunk, threadCount, vertexSources, output );
 }
 
-void CompressMesh(
+uint32_t CompressMeshChunked(
     const uint16_t* triangles,
     uint32_t triangleCount,
-    uint32_t* vertexRemap,
     uint32_t vertexCount,
     uint32_t vertexAttributeCount,
     const int16_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
     WriteBitstream& output )
 {
-    CompressMesh< uint16_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output );
+    return CompressMeshChunked< uint16_t, int16_t >( triangles, triangleCount, vertexCount, vertexAttributeCount, vertexAttributes, trianglesPerChunk, threadCount, vertexSources, output );
 }
 
-void CompressMesh(
+uint32_t CompressMeshChunked(
     const uint32_t* triangles,
     uint32_t triangleCount,
-    uint32_t* vertexRemap,
     uint32_t vertexCount,
     uint32_t vertexAttributeCount,
     const int16_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
     WriteBitstream& output )
 {
-    CompressMesh< uint32_t, int16_t >( triangles, triangleCount, vertexRemap, vertexCount, vertexAttributeCount, vertexAttributes, output );
+    return CompressMeshChunked< uint32_t, int16_t >( triangles, triangleCount, vertexCount, vertexAttributeCount, vertexAttributes, trianglesPerChunk, threadCount, vertexSources, output );
 }
@@ -27,8 +27,46 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
+#include "indexcompressionconstants.h"
 
 class WriteBitstream;
+class CountingBitstream;
+
+// Statistics about how a mesh was compressed, filled out by the CompressMesh overloads that take them (the others compile
+// the statistics gathering out entirely). Lots of free vertices, long edge distances or NEW_NEW_NEW triangles indicate a poorly
+// ordered mesh. Everything is cleared at the start of compression.
+struct MeshCompressionStats
+{
+    // Attribute columns past this are added to the last column's bit count.
+    static const uint32_t MAX_ATTRIBUTE_COLUMNS = 64;
+
+    // Number of triangles encoded with each of the IndexBufferTriangleCodes.
+    uint32_t triangleCodes[ 16 ];
+
+    // Histogram of the relative position in the edge FIFO for triangles encoded with an edge code. With MCF_LONG_EDGES, the
+    // last entry used by the FIFO size counts long edges instead.
+    uint32_t edgeDistances[ MAX_FIFO_SIZE ];
+
+    // Number of edges found in the half-edge table rather than the edge FIFO, with MCF_LONG_EDGES.
+    uint32_t longEdgeCount;
+
+    // Histogram of the relative position in the vertex FIFO for cached vertices.
+    uint32_t cachedVertexDistances[ MAX_FIFO_SIZE ];
+
+    // Number of free vertex references, with a histogram of their encoded size in bytes (index 0 is 1 byte) and the
+    // total/largest distance back from the most recent new vertex.
+    uint32_t freeVertexCount;
+    uint32_t freeVertexBytes[ 5 ];
+    uint64_t freeVertexDistanceTotal;
+    uint32_t freeVertexDistanceMax;
+
+    // Bits spent on connectivity (triangle codes, FIFO positions, free vertices and the end padding).
+    uint64_t topologyBits;
+
+    // Bits spent on each attribute column.
+    uint64_t attributeBits[ MAX_ATTRIBUTE_COLUMNS ];
+};
 
 // Compress an index buffer, writing the results out to a bitstream and providing a vertex remapping (which will be in pre-transform cache optimised
 // order).
@@ -90,4 +128,299 @@ void CompressMesh(
     const int16_t* vertexAttributes,
     WriteBitstream& output );
 
+// Same as the above, but also gathering statistics about the compression.
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats );
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats );
+
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats );
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    MeshCompressionStats& stats );
+
+// Flags for MeshCompressionOptions.
+enum MeshCompressionFlags
+{
+    // Write the connectivity and each vertex attribute column to separate byte aligned streams, behind a small table of offsets
+    // (see MESH_SEPARATE_HEADER_WORDS). The connectivity can then be decompressed without touching the attributes, unneeded
+    // attribute columns can be skipped and the columns can be decompressed in parallel. These must be decompressed with
+    // DecompressMeshSeparate/DecompressMeshTopology rather than DecompressMesh. Costs a few bytes per attribute column.
+    MCF_SEPARATE_STREAMS    = 1,
+
+    // Find cached vertices with a table of where each vertex was last pushed into the vertex FIFO (4 bytes per vertex, allocated
+    // for the duration of compression), rather than by searching the FIFO. Classifying a vertex then takes constant time whatever
+    // the FIFO size. The output is identical either way; this is mostly a win for poorly ordered meshes, where most vertices
+    // miss the FIFO and searching it is wasted work.
+    MCF_VERTEX_CURSOR_TABLE = 2,
+
+    // Find shared edges with a hash table of the half-edges of every triangle so far (96 to 192 bytes per triangle, allocated
+    // for the duration of compression), as well as in the edge FIFO. Edges that have left the FIFO are then encoded with an
+    // escape in place of the oldest FIFO position, followed by a reference to the triangle they came from (see LongEdgeEscape),
+    // when that saves a free vertex or gets a new vertex parallelogram prediction. This helps meshes with poor locality (e.g.
+    // scans and unsorted soups of connected triangles). It changes the format, so the same flag must be passed to the
+    // decompressor. Not supported by the seek index (BuildMeshSeekIndex/DecompressMeshRange), and limited to meshes of up to
+    // 357913941 triangles, as the hash table has at most 2^31 entries.
+    MCF_LONG_EDGES          = 4,
+
+    // Use 16 or 64 entries in the edge and vertex FIFOs, rather than 32, each with their own prefix codes. A smaller FIFO keeps
+    // the decompressor's state in fewer cache lines, which can suit small meshes, while a larger one finds more cached edges and
+    // vertices in big or poorly ordered meshes. These change the format, so the same flag must be passed to the decompressor.
+    // Not supported by the seek index.
+    MCF_FIFO_16             = 8,
+    MCF_FIFO_64             = 16,
+
+    // Build the prefix codes for triangle codes, edge FIFO positions and cached vertex FIFO positions from this mesh's own
+    // distribution of them, rather than using the fixed tables, and store the code lengths at the start of the connectivity
+    // (about 40 bytes with the default FIFO size). This takes an extra pass over the connectivity (without the attributes) when
+    // compressing, and the decompressor builds its decoding tables when it starts. It's worth it for meshes whose topology is
+    // unlike the typical meshes the fixed tables were fitted to (e.g. CAD meshes with many long thin triangles and fans).
+    // It changes the format, so the same flag must be passed to the decompressor. Not supported by the seek index.
+    MCF_ADAPTIVE_CODES      = 32,
+
+    // With MCF_SEPARATE_STREAMS (and ignored without it), code each attribute column's residuals with static rANS, interleaved
+    // over 4 decoders, where that is smaller than the usual universal codes. A residual's magnitude class is rANS coded and the
+    // bits below it written raw, which gets much closer to the entropy of the residuals than universal codes (which take at least
+    // a bit per residual), at the cost of a small frequency table per column and buffering the residuals while compressing. The
+    // decompressor decodes residuals a block at a time, with the interleaved decoders working in parallel. The choice is made
+    // and recorded per column (see MeshResidualCoding), so this never makes a mesh bigger by more than 4 bytes per column.
+    MCF_RANS_ATTRIBUTES     = 64,
+
+    // Implies MCF_ADAPTIVE_CODES, and also picks the prefix code for each triangle code by a context from the previous triangle's
+    // code, with a code built for each context (see MeshTriangleCodeContext). Runs of edge codes in strip-like regions then cost
+    // less than a bit a triangle, and the codes after a triangle that starts from new or free vertices are modelled apart from
+    // them. Decoding is still a single table lookup per triangle code. Costs another 21 bytes of code lengths over
+    // MCF_ADAPTIVE_CODES. It changes the format, so the same flag must be passed to the decompressor. Not supported by the seek
+    // index.
+    MCF_TRIANGLE_CONTEXTS   = 128,
+
+    // Start with a 28 byte header (see MESH_HEADER_WORDS) recording the triangle, vertex and attribute counts, the index and
+    // attribute types and the format flags, which QueryCompressedMesh reads. A loader can then size its output buffers and pick the
+    // decompression call from a single small read, without keeping that information alongside the mesh. The mesh is decompressed
+    // from after the header as usual. The output must be at a byte boundary. The decompressor doesn't need this flag.
+    MCF_MESH_HEADER         = 256,
+
+    // The flags that change the format, which the decompressor needs to know about.
+    MCF_FORMAT_FLAGS        = MCF_LONG_EDGES | MCF_FIFO_16 | MCF_FIFO_64 | MCF_ADAPTIVE_CODES | MCF_RANS_ATTRIBUTES | MCF_TRIANGLE_CONTEXTS
+};
+
+// The number of entries in the edge and vertex FIFOs for a set of MeshCompressionFlags.
+inline uint32_t MeshFifoSize( uint32_t flags )
+{
+    return ( flags & MCF_FIFO_16 ) != 0 ? 16 : ( ( flags & MCF_FIFO_64 ) != 0 ? 64 : 32 );
+}
+
+// Options for the CompressMesh overloads that take them.
+struct MeshCompressionOptions
+{
+    MeshCompressionOptions() : flags( 0 ), stats( NULL ), attributeScratch( NULL ) {}
+
+    // A combination of MeshCompressionFlags.
+    uint32_t flags;
+
+    // If not NULL, filled out with statistics about the compression (as with the overloads taking MeshCompressionStats).
+    MeshCompressionStats* stats;
+
+    // Scratch space for vertexAttributeCount words, used for meshes with more than MESH_INLINE_ATTRIBUTE_COUNT attributes (which
+    // otherwise get a buffer allocated for the duration of compression). Can be NULL, and isn't needed for fewer attributes.
+    uint32_t*             attributeScratch;
+};
+
+// Same as the above, but with the options given.
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options );
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options );
+
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options );
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    WriteBitstream& output,
+    const MeshCompressionOptions& options );
+
+// Same as the above, but only counting the bits the compressed mesh would take (see countingbitstream.h), without writing them.
+// The vertex remap and statistics are filled out as usual, and output.Size() ends up the same as for a WriteBitstream, so
+// flags or attribute quantisations can be compared more cheaply than compressing each candidate.
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options );
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options );
+
+void CompressMesh(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options );
+
+void CompressMesh(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t* vertexRemap,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    CountingBitstream& output,
+    const MeshCompressionOptions& options );
+
+// An upper bound on the size in bytes of a mesh compressed by CompressMesh (with or without options) into an empty stream,
+// including the bytes WriteBitstream::Finish writes, so a buffer of this size given to WriteBitstream never needs to grow. It
+// holds for any mesh with these counts, taking the longest prefix code for every triangle, the longest vint for every free
+// vertex and long edge reference, and the longest universal code any residual of attributeSize byte attributes can take. Always
+// a multiple of 8.
+//
+// Parameters:
+//     [in] triangleCount        - The number of triangles in the mesh.
+//     [in] vertexCount          - The number of vertices in the mesh.
+//     [in] vertexAttributeCount - The number of attributes for each vertex in the mesh.
+//     [in] attributeSize        - The size of each vertex attribute in bytes (sizeof( int16_t ) or sizeof( int32_t )).
+//     [in] flags                - The MeshCompressionFlags the mesh will be compressed with.
+size_t CompressMeshBound( uint32_t triangleCount, uint32_t vertexCount, uint32_t vertexAttributeCount, uint32_t attributeSize, uint32_t flags = 0 );
+
+// Compress a mesh as a set of independently decodable chunks of trianglesPerChunk triangles (the last chunk may be smaller), so
+// it can be decompressed on multiple threads with DecompressMeshChunked. Each chunk is compressed like a separate mesh, with its
+// own FIFOs and attribute coding state, so vertices shared between chunks are duplicated in each chunk that uses them. Smaller
+// chunks give more parallelism, at the cost of more duplicated vertices and compression; something in the range of 16k to 64k
+// triangles per chunk costs little compression on typical meshes.
+//
+// Because of the duplicated vertices, the vertex ordering is given as a mapping from the decompressed vertices to the source
+// vertices, rather than a vertex remap.
+//
+// Parameters:
+//     [in]  triangles            - A typical triangle list index buffer (3 indices to vertices per triangle). 16 bit indices.
+//     [in]  triangleCount        - The number of triangles to process.
+//     [in]  vertexCount          - The number of vertices in the mesh.
+//     [in]  vertexAttributeCount - The number of attributes for each vertex in the mesh.
+//     [in]  vertexAttributes     - The vertex attributes, as for CompressMesh.
+//     [in]  trianglesPerChunk    - The number of triangles in each chunk (greater than 0).
+//     [in]  threadCount          - The number of threads used to compress chunks (0 for one per hardware thread, 1 for the calling thread only).
+//     [out] vertexSources        - For each decompressed vertex, the source vertex it comes from. This should have space for
+//                                  triangleCount * 3 entries, which is the worst case (all of the vertices duplicated).
+//     [in]  output               - The stream that the compressed data will be written to. This must be at a byte boundary,
+//                                  and as with CompressMesh, WriteBitstream::Finish will need to be called after this.
+// Returns the number of vertices in the decompressed mesh.
+uint32_t CompressMeshChunked(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
+    WriteBitstream& output );
+
+// Same as above but 32bit indices.
+uint32_t CompressMeshChunked(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int32_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
+    WriteBitstream& output );
+
+// Same as above but 16bit indices and 16 bit attributes.
+uint32_t CompressMeshChunked(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
+    WriteBitstream& output );
+
+// Same as above but 32bit indices and 16 bit attributes.
+uint32_t CompressMeshChunked(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    const int16_t* vertexAttributes,
+    uint32_t trianglesPerChunk,
+    uint32_t threadCount,
+    uint32_t* vertexSources,
+    WriteBitstream& output );
+
 #endif // -- MESH_COMPRESSION_H__
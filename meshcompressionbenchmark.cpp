@@ -0,0 +1,1077 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Benchmark harness for CompressMesh/DecompressMesh, run over the synthetic mesh corpus from meshgenerator.h.
+//
+// Usage: meshcompressionbenchmark [target triangle count] [vertex attribute count] [iterations]
+//
+// Each index/attribute type combination is compressed and decompressed "iterations" times, with the fastest run reported.
+// Every decompression is checked against the source mesh, so a mismatch is reported as a failure rather than a fast time.
+// Meshes are compressed into a buffer of CompressMeshBound bytes, where needing any more is also reported as a failure.
+
+#include "meshcompression.h"
+#include "meshdecompression.h"
+#include "meshgenerator.h"
+#include "meshreorder.h"
+#include "writebitstream.h"
+#include "readbitstream.h"
+#include "countingbitstream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// Extra bytes past the end of a compressed buffer, because ReadBitstream refills in 8 byte chunks.
+static const size_t READ_PADDING_BYTES = 16;
+
+// Chunk size for the chunked compression benchmark.
+static const uint32_t TRIANGLES_PER_CHUNK = 16384;
+
+// Triangles decompressed per call for the incremental decompression benchmark.
+static const uint32_t INCREMENTAL_TRIANGLES = 1000;
+
+// Seek index interval and the size of the ranges decompressed with it.
+static const uint32_t SEEK_INTERVAL   = 4096;
+static const uint32_t SEEK_RANGE_SIZE = 1024;
+
+// Size of the caller buffer for the caller buffer and arena benchmarks, small enough that all but the smallest meshes grow out of it.
+static const size_t CALLER_BUFFER_BYTES = 64;
+
+// Buffer sizes for the sink benchmark, small enough that the buffer is handed to the sink many times, and for the file sink.
+static const size_t SINK_BUFFER_BYTES      = 24;
+static const size_t FILE_SINK_BUFFER_BYTES = 4096;
+
+// How the mesh is compressed and decompressed by RunBenchmark.
+enum BenchmarkMode
+{
+    // DecompressMesh in one call.
+    BM_ONE_SHOT,
+
+    // MeshDecompressor, INCREMENTAL_TRIANGLES at a time.
+    BM_INCREMENTAL,
+
+    // Compressed with MCF_VERTEX_CURSOR_TABLE, decompressed with DecompressMesh in one call.
+    BM_CURSOR_TABLE,
+
+    // Compressed with MCF_LONG_EDGES, decompressed with DecompressMesh in one call.
+    BM_LONG_EDGES,
+
+    // Compressed with MCF_FIFO_16, decompressed with DecompressMesh in one call.
+    BM_FIFO_16,
+
+    // Compressed with MCF_FIFO_64, decompressed with DecompressMesh in one call.
+    BM_FIFO_64,
+
+    // Compressed with MCF_ADAPTIVE_CODES, decompressed with DecompressMesh in one call.
+    BM_ADAPTIVE_CODES,
+
+    // Compressed with MCF_TRIANGLE_CONTEXTS, decompressed with DecompressMesh in one call.
+    BM_TRIANGLE_CONTEXTS,
+
+    // Compressed with MCF_SEPARATE_STREAMS and decompressed with DecompressMeshSeparate on all threads.
+    BM_SEPARATE,
+
+    // Compressed with MCF_SEPARATE_STREAMS and MCF_RANS_ATTRIBUTES, decompressed with DecompressMeshSeparate on all threads.
+    BM_RANS,
+
+    // Compressed with MCF_SEPARATE_STREAMS and only the connectivity decompressed, with DecompressMeshTopology.
+    BM_TOPOLOGY,
+
+    // Compressed with MCF_SEPARATE_STREAMS and only the connectivity and positions decompressed, with DecompressMeshMasked.
+    BM_POSITIONS,
+
+    // Compressed into a CALLER_BUFFER_BYTES caller buffer that grows into new[] buffers (if it doesn't fit), then detached.
+    BM_CALLER_BUFFER,
+
+    // Compressed into a CALLER_BUFFER_BYTES caller buffer that grows into buffers from an arena without Free (if it doesn't fit),
+    // then detached.
+    BM_ARENA
+};
+
+// The attribute columns generated for positions (see meshgenerator.h).
+static const uint64_t POSITION_ATTRIBUTE_MASK = 0x7;
+
+// Meshes with more than MESH_INLINE_ATTRIBUTE_COUNT attributes are benchmarked with an attribute scratch buffer.
+static const uint32_t MAX_ATTRIBUTE_COUNT = 256;
+
+// Timing and size results for a single index/attribute type combination.
+struct BenchmarkResult
+{
+    double compressSeconds;
+
+    // Compressing into a CountingBitstream, for the size alone (0 where it isn't measured).
+    double countSeconds;
+    double decompressSeconds;
+    size_t compressedBits;
+    size_t decompressedBytes;
+    bool   verified;
+};
+
+// A bump allocator for the arena benchmark, where nothing is given back until the arena is emptied.
+struct BenchmarkArena
+{
+    std::vector< uint8_t > storage;
+    size_t                 used;
+};
+
+static uint8_t* BenchmarkArenaAllocate( size_t size, void* user )
+{
+    BenchmarkArena* arena = static_cast< BenchmarkArena* >( user );
+
+    if ( arena->used + size > arena->storage.size() )
+    {
+        fprintf( stderr, "benchmark arena exhausted\n" );
+        exit( 1 );
+    }
+
+    uint8_t* buffer = &arena->storage[ arena->used ];
+
+    arena->used += size;
+
+    return buffer;
+}
+
+// Sink appending to a byte vector, which is the user pointer.
+static void BenchmarkVectorSinkWrite( const uint8_t* data, size_t size, void* user )
+{
+    std::vector< uint8_t >* bytes = static_cast< std::vector< uint8_t >* >( user );
+
+    bytes->insert( bytes->end(), data, data + size );
+}
+
+static double Now()
+{
+    typedef std::chrono::high_resolution_clock Clock;
+
+    return std::chrono::duration< double >( Clock::now().time_since_epoch() ).count();
+}
+
+// Is the attribute column in attributeMask? Columns past the 64 the mask has bits for are only in the full mask.
+static bool InAttributeMask( uint64_t attributeMask, uint32_t attributeIndex )
+{
+    return attributeIndex < 64 ? ( ( attributeMask >> attributeIndex ) & 1 ) != 0 : attributeMask == ~uint64_t( 0 );
+}
+
+// The number of a mesh's attribute columns in attributeMask.
+static uint32_t MaskedAttributeCount( const GeneratedMesh& mesh, uint64_t attributeMask )
+{
+    uint32_t count = 0;
+
+    for ( uint32_t attributeIndex = 0; attributeIndex < mesh.vertexAttributeCount; ++attributeIndex )
+    {
+        count += InAttributeMask( attributeMask, attributeIndex ) ? 1 : 0;
+    }
+
+    return count;
+}
+
+// Check the decompressed mesh matches the source mesh, once mapped through the vertex remap. Only the attribute columns in
+// attributeMask are checked, where vertexAttributes has those columns packed together.
+// Note that compression preserves the winding order of triangles, but may rotate the vertices within a triangle.
+template < typename IndiceType, typename AttributeType >
+static bool VerifyMesh(
+    const GeneratedMesh& mesh,
+    const uint32_t* vertexRemap,
+    const IndiceType* triangles,
+    const AttributeType* vertexAttributes,
+    uint64_t attributeMask = ~uint64_t( 0 ) )
+{
+    uint32_t decodedAttributeCount = MaskedAttributeCount( mesh, attributeMask );
+
+    for ( uint32_t triangle = 0; triangle < mesh.triangleCount; ++triangle )
+    {
+        const uint32_t*   source  = &mesh.triangles[ triangle * 3 ];
+        const IndiceType* decoded = triangles + ( triangle * 3 );
+        uint32_t          first   = vertexRemap[ source[ 0 ] ];
+        uint32_t          second  = vertexRemap[ source[ 1 ] ];
+        uint32_t          third   = vertexRemap[ source[ 2 ] ];
+
+        bool matches = ( decoded[ 0 ] == first && decoded[ 1 ] == second && decoded[ 2 ] == third ) ||
+                       ( decoded[ 0 ] == second && decoded[ 1 ] == third && decoded[ 2 ] == first ) ||
+                       ( decoded[ 0 ] == third && decoded[ 1 ] == first && decoded[ 2 ] == second );
+
+        if ( !matches )
+        {
+            return false;
+        }
+    }
+
+    for ( uint32_t vertex = 0; vertex < mesh.vertexCount && decodedAttributeCount > 0; ++vertex )
+    {
+        uint32_t remapped = vertexRemap[ vertex ];
+
+        if ( remapped == 0xFFFFFFFF )
+        {
+            continue;
+        }
+
+        const int32_t*       source  = &mesh.vertexAttributes[ vertex * mesh.vertexAttributeCount ];
+        const AttributeType* decoded = vertexAttributes + ( remapped * decodedAttributeCount );
+
+        for ( uint32_t attributeIndex = 0; attributeIndex < mesh.vertexAttributeCount; ++attributeIndex )
+        {
+            if ( !InAttributeMask( attributeMask, attributeIndex ) )
+            {
+                continue;
+            }
+
+            if ( *decoded++ != static_cast< AttributeType >( source[ attributeIndex ] ) )
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template < typename IndiceType, typename AttributeType >
+static BenchmarkResult RunBenchmark( const GeneratedMesh& mesh, uint32_t iterations, BenchmarkMode mode = BM_ONE_SHOT )
+{
+    MeshCompressionOptions options;
+
+    uint64_t               attributeMask = mode == BM_TOPOLOGY ? 0 : mode == BM_POSITIONS ? POSITION_ATTRIBUTE_MASK : ~uint64_t( 0 );
+
+    switch ( mode )
+    {
+    case BM_ONE_SHOT:
+    case BM_INCREMENTAL:
+    case BM_CALLER_BUFFER:
+    case BM_ARENA:
+
+        options.flags = 0;
+        break;
+
+    case BM_CURSOR_TABLE:
+
+        options.flags = MCF_VERTEX_CURSOR_TABLE;
+        break;
+
+    case BM_LONG_EDGES:
+
+        options.flags = MCF_LONG_EDGES;
+        break;
+
+    case BM_FIFO_16:
+
+        options.flags = MCF_FIFO_16;
+        break;
+
+    case BM_FIFO_64:
+
+        options.flags = MCF_FIFO_64;
+        break;
+
+    case BM_ADAPTIVE_CODES:
+
+        options.flags = MCF_ADAPTIVE_CODES;
+        break;
+
+    case BM_TRIANGLE_CONTEXTS:
+
+        options.flags = MCF_TRIANGLE_CONTEXTS;
+        break;
+
+    case BM_SEPARATE:
+    case BM_TOPOLOGY:
+    case BM_POSITIONS:
+
+        options.flags = MCF_SEPARATE_STREAMS;
+        break;
+
+    case BM_RANS:
+
+        options.flags = MCF_SEPARATE_STREAMS | MCF_RANS_ATTRIBUTES;
+        break;
+    }
+
+    std::vector< IndiceType >    triangles( mesh.triangles.begin(), mesh.triangles.end() );
+    std::vector< AttributeType > vertexAttributes( mesh.vertexAttributes.size() );
+    std::vector< uint32_t >      vertexRemap( mesh.vertexCount );
+    std::vector< uint32_t >      attributeScratch( mesh.vertexAttributeCount );
+    std::vector< uint8_t >       compressed;
+    BenchmarkResult              result;
+
+    // Compressing into a buffer of the worst case size should never need to grow it.
+    std::vector< uint8_t >       boundBuffer( CompressMeshBound( mesh.triangleCount, mesh.vertexCount, mesh.vertexAttributeCount, sizeof( AttributeType ), options.flags ) );
+
+    // The smaller caller buffer grows when the mesh doesn't fit, in the arena benchmark into buffers that sum to under twice the final
+    // buffer's size.
+    std::vector< uint8_t >       callerBuffer( CALLER_BUFFER_BYTES );
+    uint8_t*                     outputBuffer   = mode == BM_CALLER_BUFFER || mode == BM_ARENA ? &callerBuffer[ 0 ] : &boundBuffer[ 0 ];
+    size_t                       outputCapacity = mode == BM_CALLER_BUFFER || mode == BM_ARENA ? callerBuffer.size() : boundBuffer.size();
+    BenchmarkArena               arena;
+    WriteBitstreamAllocator      arenaAllocator = { BenchmarkArenaAllocate, NULL, &arena };
+
+    arena.storage.resize( boundBuffer.size() * 4 );
+
+    options.attributeScratch = &attributeScratch[ 0 ];
+
+    for ( size_t where = 0; where < vertexAttributes.size(); ++where )
+    {
+        vertexAttributes[ where ] = static_cast< AttributeType >( mesh.vertexAttributes[ where ] );
+    }
+
+    result.compressSeconds   = 1e30;
+    result.countSeconds      = 1e30;
+    result.decompressSeconds = 1e30;
+    result.verified          = true;
+
+    for ( uint32_t iteration = 0; iteration < iterations; ++iteration )
+    {
+        arena.used = 0;
+
+        WriteBitstream output( outputBuffer, outputCapacity, mode == BM_ARENA ? &arenaAllocator : NULL );
+
+        double start = Now();
+
+        CompressMesh(
+            &triangles[ 0 ],
+            mesh.triangleCount,
+            &vertexRemap[ 0 ],
+            mesh.vertexCount,
+            mesh.vertexAttributeCount,
+            &vertexAttributes[ 0 ],
+            output,
+            options );
+
+        output.Finish();
+
+        double elapsed = Now() - start;
+
+        if ( elapsed < result.compressSeconds )
+        {
+            result.compressSeconds = elapsed;
+        }
+
+        size_t compressedBytes = output.ByteSize();
+
+        result.compressedBits = output.Size();
+        result.verified       = result.verified && compressedBytes <= boundBuffer.size();
+
+        // Counting has to give exactly the size compressing for real does.
+        CountingBitstream counter;
+
+        start = Now();
+
+        CompressMesh(
+            &triangles[ 0 ],
+            mesh.triangleCount,
+            &vertexRemap[ 0 ],
+            mesh.vertexCount,
+            mesh.vertexAttributeCount,
+            &vertexAttributes[ 0 ],
+            counter,
+            options );
+
+        elapsed = Now() - start;
+
+        if ( elapsed < result.countSeconds )
+        {
+            result.countSeconds = elapsed;
+        }
+
+        result.verified = result.verified && counter.Size() == result.compressedBits && counter.ByteSize() == compressedBytes;
+
+        uint8_t* detached = output.Detach();
+
+        // The stream stays in the caller's buffer exactly when the whole 64 bit words it writes fit, otherwise it's left behind and
+        // the detached buffer is the caller's to free.
+        bool fits = ( ( compressedBytes + 7 ) & ~size_t( 7 ) ) <= outputCapacity;
+
+        result.verified = result.verified && ( detached == outputBuffer ) == fits;
+
+        compressed.assign( detached, detached + compressedBytes );
+        compressed.resize( compressed.size() + READ_PADDING_BYTES, 0 );
+
+        if ( detached != outputBuffer && mode != BM_ARENA )
+        {
+            delete[] detached;
+        }
+    }
+
+    uint32_t usedVertexCount = 0;
+
+    for ( uint32_t vertex = 0; vertex < mesh.vertexCount; ++vertex )
+    {
+        usedVertexCount += vertexRemap[ vertex ] != 0xFFFFFFFF;
+    }
+
+    std::vector< IndiceType >    decodedTriangles( mesh.triangleCount * 3 );
+    std::vector< AttributeType > decodedAttributes( usedVertexCount * mesh.vertexAttributeCount );
+
+    result.decompressedBytes = ( decodedTriangles.size() * sizeof( IndiceType ) ) + ( usedVertexCount * MaskedAttributeCount( mesh, attributeMask ) * sizeof( AttributeType ) );
+
+    for ( uint32_t iteration = 0; iteration < iterations; ++iteration )
+    {
+        ::memset( &decodedTriangles[ 0 ], 0, decodedTriangles.size() * sizeof( IndiceType ) );
+
+        ReadBitstream input( &compressed[ 0 ], compressed.size() );
+
+        double start = Now();
+
+        switch ( mode )
+        {
+        case BM_ONE_SHOT:
+        case BM_CALLER_BUFFER:
+        case BM_ARENA:
+        case BM_CURSOR_TABLE:
+        case BM_LONG_EDGES:
+        case BM_FIFO_16:
+        case BM_FIFO_64:
+        case BM_ADAPTIVE_CODES:
+        case BM_TRIANGLE_CONTEXTS:
+
+            DecompressMesh( &decodedTriangles[ 0 ], mesh.triangleCount, mesh.vertexAttributeCount, &decodedAttributes[ 0 ], input, options.flags, &attributeScratch[ 0 ] );
+            break;
+
+        case BM_INCREMENTAL:
+        {
+            MeshDecompressor decompressor( &decodedTriangles[ 0 ], mesh.triangleCount, mesh.vertexAttributeCount, &decodedAttributes[ 0 ], input, 0, &attributeScratch[ 0 ] );
+
+            while ( decompressor.DecodeTriangles( INCREMENTAL_TRIANGLES ) > 0 )
+            {
+            }
+
+            break;
+        }
+        case BM_SEPARATE:
+        case BM_RANS:
+
+            DecompressMeshSeparate( &decodedTriangles[ 0 ], mesh.triangleCount, mesh.vertexAttributeCount, &decodedAttributes[ 0 ], &compressed[ 0 ], compressed.size(), 0 );
+            break;
+
+        case BM_TOPOLOGY:
+
+            DecompressMeshTopology( &decodedTriangles[ 0 ], mesh.triangleCount, &compressed[ 0 ], compressed.size() );
+            break;
+
+        case BM_POSITIONS:
+
+            DecompressMeshMasked( &decodedTriangles[ 0 ], mesh.triangleCount, attributeMask, &decodedAttributes[ 0 ], &compressed[ 0 ], compressed.size(), 0 );
+            break;
+        }
+
+        double elapsed = Now() - start;
+
+        if ( elapsed < result.decompressSeconds )
+        {
+            result.decompressSeconds = elapsed;
+        }
+
+        result.verified = result.verified && VerifyMesh( mesh, &vertexRemap[ 0 ], &decodedTriangles[ 0 ], &decodedAttributes[ 0 ], attributeMask );
+    }
+
+    return result;
+}
+
+// Check a decompressed chunked mesh matches the source mesh, mapping decompressed vertices back to the source through vertexSources.
+template < typename IndiceType, typename AttributeType >
+static bool VerifyChunkedMesh(
+    const GeneratedMesh& mesh,
+    const uint32_t* vertexSources,
+    uint32_t chunkedVertexCount,
+    const IndiceType* triangles,
+    const AttributeType* vertexAttributes )
+{
+    for ( uint32_t triangle = 0; triangle < mesh.triangleCount; ++triangle )
+    {
+        const uint32_t*   source  = &mesh.triangles[ triangle * 3 ];
+        const IndiceType* decoded = triangles + ( triangle * 3 );
+
+        if ( decoded[ 0 ] >= chunkedVertexCount || decoded[ 1 ] >= chunkedVertexCount || decoded[ 2 ] >= chunkedVertexCount )
+        {
+            return false;
+        }
+
+        uint32_t first  = vertexSources[ decoded[ 0 ] ];
+        uint32_t second = vertexSources[ decoded[ 1 ] ];
+        uint32_t third  = vertexSources[ decoded[ 2 ] ];
+
+        bool matches = ( source[ 0 ] == first && source[ 1 ] == second && source[ 2 ] == third ) ||
+                       ( source[ 0 ] == second && source[ 1 ] == third && source[ 2 ] == first ) ||
+                       ( source[ 0 ] == third && source[ 1 ] == first && source[ 2 ] == second );
+
+        if ( !matches )
+        {
+            return false;
+        }
+    }
+
+    for ( uint32_t vertex = 0; vertex < chunkedVertexCount; ++vertex )
+    {
+        const int32_t*       source  = &mesh.vertexAttributes[ vertexSources[ vertex ] * mesh.vertexAttributeCount ];
+        const AttributeType* decoded = vertexAttributes + ( vertex * mesh.vertexAttributeCount );
+
+        for ( uint32_t attributeIndex = 0; attributeIndex < mesh.vertexAttributeCount; ++attributeIndex )
+        {
+            if ( decoded[ attributeIndex ] != static_cast< AttributeType >( source[ attributeIndex ] ) )
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Same as RunBenchmark, but compressing in chunks and decompressing them on threadCount threads.
+template < typename IndiceType, typename AttributeType >
+static BenchmarkResult RunChunkedBenchmark( const GeneratedMesh& mesh, uint32_t iterations, uint32_t threadCount )
+{
+    std::vector< IndiceType >    triangles( mesh.triangles.begin(), mesh.triangles.end() );
+    std::vector< AttributeType > vertexAttributes( mesh.vertexAttributes.size() );
+    std::vector< uint32_t >      vertexSources( mesh.triangleCount * 3 );
+    std::vector< uint8_t >       compressed;
+    uint32_t                     chunkedVertexCount = 0;
+    BenchmarkResult              result;
+
+    for ( size_t where = 0; where < vertexAttributes.size(); ++where )
+    {
+        vertexAttributes[ where ] = static_cast< AttributeType >( mesh.vertexAttributes[ where ] );
+    }
+
+    result.compressSeconds   = 1e30;
+    result.countSeconds      = 0;
+    result.decompressSeconds = 1e30;
+
+    for ( uint32_t iteration = 0; iteration < iterations; ++iteration )
+    {
+        WriteBitstream output( 64 * 1024 );
+
+        double start = Now();
+
+        chunkedVertexCount = CompressMeshChunked(
+            &triangles[ 0 ],
+            mesh.triangleCount,
+            mesh.vertexCount,
+            mesh.vertexAttributeCount,
+            &vertexAttributes[ 0 ],
+            TRIANGLES_PER_CHUNK,
+            threadCount,
+            &vertexSources[ 0 ],
+            output );
+
+        output.Finish();
+
+        double elapsed = Now() - start;
+
+        if ( elapsed < result.compressSeconds )
+        {
+            result.compressSeconds = elapsed;
+        }
+
+        result.compressedBits = output.Size();
+
+        compressed.assign( output.RawData(), output.RawData() + output.ByteSize() );
+        compressed.resize( compressed.size() + READ_PADDING_BYTES, 0 );
+    }
+
+    std::vector< IndiceType >    decodedTriangles( mesh.triangleCount * 3 );
+    std::vector< AttributeType > decodedAttributes( chunkedVertexCount * mesh.vertexAttributeCount );
+
+    result.verified          = GetMeshChunkedVertexCount( &compressed[ 0 ] ) == chunkedVertexCount;
+    result.decompressedBytes = ( decodedTriangles.size() * sizeof( IndiceType ) ) + ( decodedAttributes.size() * sizeof( AttributeType ) );
+
+    for ( uint32_t iteration = 0; iteration < iterations; ++iteration )
+    {
+        ::memset( &decodedTriangles[ 0 ], 0, decodedTriangles.size() * sizeof( IndiceType ) );
+
+        double start = Now();
+
+        DecompressMeshChunked( &decodedTriangles[ 0 ], mesh.triangleCount, mesh.vertexAttributeCount, &decodedAttributes[ 0 ], &compressed[ 0 ], compressed.size(), threadCount );
+
+        double elapsed = Now() - start;
+
+        if ( elapsed < result.decompressSeconds )
+        {
+            result.decompressSeconds = elapsed;
+        }
+
+        result.verified = result.verified && VerifyChunkedMesh( mesh, &vertexSources[ 0 ], chunkedVertexCount, &decodedTriangles[ 0 ], &decodedAttributes[ 0 ] );
+    }
+
+    return result;
+}
+
+// Build a seek index and decompress ranges with it, checking the triangles against a full decompression (and the attributes, where
+// the range's dependencies have been decompressed already) and reporting the index size and average range decompression time.
+static bool RunSeekBenchmark( const GeneratedMesh& mesh )
+{
+    std::vector< uint32_t > vertexRemap( mesh.vertexCount );
+    WriteBitstream          output( 64 * 1024 );
+    WriteBitstream          seekIndexOutput( 4 * 1024 );
+    std::vector< uint8_t >  compressed;
+
+    CompressMesh( &mesh.triangles[ 0 ], mesh.triangleCount, &vertexRemap[ 0 ], mesh.vertexCount, mesh.vertexAttributeCount, &mesh.vertexAttributes[ 0 ], output );
+
+    output.Finish();
+
+    compressed.assign( output.RawData(), output.RawData() + output.ByteSize() );
+    compressed.resize( compressed.size() + READ_PADDING_BYTES, 0 );
+
+    uint32_t usedVertexCount = 0;
+
+    for ( uint32_t vertex = 0; vertex < mesh.vertexCount; ++vertex )
+    {
+        usedVertexCount += vertexRemap[ vertex ] != 0xFFFFFFFF;
+    }
+
+    BuildMeshSeekIndex( &compressed[ 0 ], compressed.size(), mesh.triangleCount, usedVertexCount, mesh.vertexAttributeCount, SEEK_INTERVAL, seekIndexOutput );
+
+    seekIndexOutput.Finish();
+
+    const uint8_t*          seekIndex = seekIndexOutput.RawData();
+    std::vector< uint32_t > triangles( mesh.triangleCount * 3 );
+    std::vector< int32_t >  vertexAttributes( usedVertexCount * mesh.vertexAttributeCount );
+    std::vector< uint32_t > rangeTriangles( mesh.triangleCount * 3 );
+    std::vector< int32_t >  rangeAttributes( usedVertexCount * mesh.vertexAttributeCount );
+    std::vector< uint32_t > attributeScratch( mesh.vertexAttributeCount );
+    ReadBitstream           input( &compressed[ 0 ], compressed.size() );
+    bool                    verified   = true;
+    uint32_t                rangeCount = 0;
+    double                  rangeTime  = 0;
+
+    DecompressMesh( &triangles[ 0 ], mesh.triangleCount, mesh.vertexAttributeCount, &vertexAttributes[ 0 ], input, 0, &attributeScratch[ 0 ] );
+
+    // Every third range from the end backwards, which only have exact triangles (their attributes can depend on vertices that haven't
+    // been decompressed), then every range from the start forwards, where the ranges before have decompressed all the dependencies.
+    for ( uint32_t pass = 0; pass < 2; ++pass )
+    {
+        uint32_t rangeStep = pass == 0 ? 3 : 1;
+
+        for ( uint32_t range = 0; range * SEEK_RANGE_SIZE < mesh.triangleCount; range += rangeStep )
+        {
+            uint32_t rangeEnd      = mesh.triangleCount - ( range * SEEK_RANGE_SIZE );
+            uint32_t firstTriangle = pass == 0 ? ( rangeEnd > SEEK_RANGE_SIZE ? rangeEnd - SEEK_RANGE_SIZE : 0 ) : range * SEEK_RANGE_SIZE;
+            uint32_t lastTriangle  = pass == 0 ? rangeEnd : std::min( firstTriangle + SEEK_RANGE_SIZE, mesh.triangleCount );
+
+            double start = Now();
+
+            DecompressMeshRange( firstTriangle, lastTriangle, &rangeTriangles[ 0 ], mesh.vertexAttributeCount, &rangeAttributes[ 0 ], &compressed[ 0 ], compressed.size(), seekIndex );
+
+            rangeTime += Now() - start;
+            ++rangeCount;
+
+            verified = verified && ::memcmp( &rangeTriangles[ firstTriangle * 3 ], &triangles[ firstTriangle * 3 ], ( lastTriangle - firstTriangle ) * 3 * sizeof( uint32_t ) ) == 0;
+        }
+
+        if ( pass == 0 )
+        {
+            std::fill( rangeAttributes.begin(), rangeAttributes.end(), 0 );
+        }
+    }
+
+    verified = verified && rangeAttributes == vertexAttributes;
+
+    printf( "%-20s seek index %.1f%% of compressed size, %.1f us per %u triangle range  %s\n",
+            "",
+            ( 100.0 * seekIndexOutput.ByteSize() ) / output.ByteSize(),
+            ( rangeTime * 1e6 ) / rangeCount,
+            SEEK_RANGE_SIZE,
+            verified ? "ok" : "MISMATCH" );
+
+    return verified;
+}
+
+// Decompress a buffer of all one bits as a mesh with adaptive codes, interleaved and with separate streams, where every code
+// length is longer than the decoding tables allow, checking it's rejected rather than decoded.
+static bool RunCorruptCodesBenchmark()
+{
+    std::vector< uint8_t >  corrupt( 4096, 0xFF );
+    std::vector< uint32_t > triangles( 3 );
+    std::vector< int32_t >  vertexAttributes( 3 );
+    bool                    verified = true;
+
+    for ( uint32_t pass = 0; pass < 2; ++pass )
+    {
+        ReadBitstream input( &corrupt[ 0 ], corrupt.size() );
+
+        verified = verified && !DecompressMesh( &triangles[ 0 ], 1, 1, &vertexAttributes[ 0 ], input, pass > 0 ? MCF_TRIANGLE_CONTEXTS : MCF_ADAPTIVE_CODES );
+    }
+
+    // A separate streams header for one attribute column, with every flag set.
+    std::vector< uint8_t > separate( corrupt );
+
+    ::memset( &separate[ 0 ], 0, 8 );
+
+    separate[ 4 ] = 1;
+
+    verified = verified && !DecompressMeshTopology( &triangles[ 0 ], 1, &separate[ 0 ], separate.size() );
+
+    printf( "corrupt adaptive code lengths rejected  %s\n\n", verified ? "ok" : "MISMATCH" );
+
+    return verified;
+}
+
+// Compress with MCF_MESH_HEADER, interleaved and with separate streams, and decompress with only what QueryCompressedMesh says about
+// the mesh, then check QueryCompressedMesh rejects a truncated header and a buffer without one. The last pass asks for rANS without
+// separate streams and for triangle contexts alone, which the header should record as the format actually written.
+static bool RunHeaderBenchmark( const GeneratedMesh& mesh )
+{
+    static const uint32_t passFlags[]   = { 0, MCF_SEPARATE_STREAMS, MCF_RANS_ATTRIBUTES | MCF_TRIANGLE_CONTEXTS };
+    static const uint32_t headerFlags[] = { 0, MCF_SEPARATE_STREAMS, MCF_TRIANGLE_CONTEXTS | MCF_ADAPTIVE_CODES };
+
+    std::vector< uint32_t > vertexRemap( mesh.vertexCount );
+    bool                    verified = true;
+
+    for ( uint32_t pass = 0; pass < sizeof( passFlags ) / sizeof( passFlags[ 0 ] ); ++pass )
+    {
+        MeshCompressionOptions options;
+        WriteBitstream         output( 64 * 1024 );
+        std::vector< uint8_t > compressed;
+        CompressedMeshInfo     info;
+
+        options.flags = MCF_MESH_HEADER | passFlags[ pass ];
+
+        CompressMesh( &mesh.triangles[ 0 ], mesh.triangleCount, &vertexRemap[ 0 ], mesh.vertexCount, mesh.vertexAttributeCount, &mesh.vertexAttributes[ 0 ], output, options );
+
+        output.Finish();
+
+        compressed.assign( output.RawData(), output.RawData() + output.ByteSize() );
+        compressed.resize( compressed.size() + READ_PADDING_BYTES, 0 );
+
+        if ( !QueryCompressedMesh( &compressed[ 0 ], compressed.size(), info ) ||
+             info.indexSize != sizeof( uint32_t ) ||
+             info.attributeSize != sizeof( int32_t ) ||
+             info.flags != headerFlags[ pass ] )
+        {
+            verified = false;
+            continue;
+        }
+
+        std::vector< uint32_t > triangles( info.triangleCount * 3 );
+        std::vector< int32_t >  vertexAttributes( info.vertexCount * info.vertexAttributeCount );
+        std::vector< uint32_t > attributeScratch( info.vertexAttributeCount );
+        const uint8_t*          meshData = &compressed[ info.headerSize ];
+        size_t                  meshSize = compressed.size() - info.headerSize;
+
+        if ( ( info.flags & MCF_SEPARATE_STREAMS ) != 0 )
+        {
+            DecompressMeshSeparate( &triangles[ 0 ], info.triangleCount, info.vertexAttributeCount, &vertexAttributes[ 0 ], meshData, meshSize, 0 );
+        }
+        else
+        {
+            ReadBitstream input( meshData, meshSize );
+
+            DecompressMesh( &triangles[ 0 ], info.triangleCount, info.vertexAttributeCount, &vertexAttributes[ 0 ], input, info.flags, &attributeScratch[ 0 ] );
+        }
+
+        verified = verified &&
+                   info.triangleCount == mesh.triangleCount &&
+                   info.vertexAttributeCount == mesh.vertexAttributeCount &&
+                   VerifyMesh( mesh, &vertexRemap[ 0 ], &triangles[ 0 ], &vertexAttributes[ 0 ] );
+
+        // A buffer too small for the header, and one that doesn't start with a header.
+        std::vector< uint8_t > garbage( compressed.size(), 0xA5 );
+
+        verified = verified &&
+                   !QueryCompressedMesh( &compressed[ 0 ], info.headerSize - 1, info ) &&
+                   !QueryCompressedMesh( &garbage[ 0 ], garbage.size(), info );
+    }
+
+    printf( "%-20s mesh header round trip, interleaved, separate streams and format flags  %s\n", "", verified ? "ok" : "MISMATCH" );
+
+    return verified;
+}
+
+// Compress through a SINK_BUFFER_BYTES buffer to a sink (twice, with a Reset after the first has been handed over) and through the
+// file sink to a temporary file, checking each gives exactly the bytes compressing in memory does.
+static bool RunSinkBenchmark( const GeneratedMesh& mesh )
+{
+    std::vector< uint32_t > vertexRemap( mesh.vertexCount );
+    WriteBitstream          output( 64 * 1024 );
+    std::vector< uint8_t >  sunk;
+    WriteBitstreamSink      vectorSink = { BenchmarkVectorSinkWrite, &sunk };
+    WriteBitstream          sinkOutput( SINK_BUFFER_BYTES, vectorSink );
+    bool                    verified   = true;
+
+    CompressMesh( &mesh.triangles[ 0 ], mesh.triangleCount, &vertexRemap[ 0 ], mesh.vertexCount, mesh.vertexAttributeCount, &mesh.vertexAttributes[ 0 ], output );
+
+    output.Finish();
+
+    size_t compressedBytes = output.ByteSize();
+
+    for ( uint32_t pass = 0; pass < 2; ++pass )
+    {
+        if ( pass > 0 )
+        {
+            sinkOutput.Reset();
+            sunk.clear();
+        }
+
+        CompressMesh( &mesh.triangles[ 0 ], mesh.triangleCount, &vertexRemap[ 0 ], mesh.vertexCount, mesh.vertexAttributeCount, &mesh.vertexAttributes[ 0 ], sinkOutput );
+
+        sinkOutput.Finish();
+
+        verified = verified && sinkOutput.ByteSize() == compressedBytes && sunk.size() == compressedBytes &&
+                   ::memcmp( &sunk[ 0 ], output.RawData(), compressedBytes ) == 0;
+    }
+
+    FILE* file = tmpfile();
+
+    if ( file != NULL )
+    {
+        std::vector< uint8_t > fileBytes( compressedBytes + 1 );
+
+        {
+            WriteBitstream fileOutput( FILE_SINK_BUFFER_BYTES, WriteBitstreamFileSink( file ) );
+
+            CompressMesh( &mesh.triangles[ 0 ], mesh.triangleCount, &vertexRemap[ 0 ], mesh.vertexCount, mesh.vertexAttributeCount, &mesh.vertexAttributes[ 0 ], fileOutput );
+
+            fileOutput.Finish();
+        }
+
+        rewind( file );
+
+        size_t readBytes = fread( &fileBytes[ 0 ], 1, fileBytes.size(), file );
+
+        verified = verified && !ferror( file ) && readBytes == compressedBytes && ::memcmp( &fileBytes[ 0 ], output.RawData(), compressedBytes ) == 0;
+
+        fclose( file );
+    }
+    else
+    {
+        verified = false;
+    }
+
+    printf( "%-20s sink output through %u and %u byte buffers matches in memory output  %s\n",
+            "",
+            static_cast< uint32_t >( SINK_BUFFER_BYTES ),
+            static_cast< uint32_t >( FILE_SINK_BUFFER_BYTES ),
+            verified ? "ok" : "MISMATCH" );
+
+    return verified;
+}
+
+// Compress once more, gathering statistics about where the bits went and how well ordered the mesh is.
+static void PrintStats( const char* name, const GeneratedMesh& mesh )
+{
+    std::vector< uint32_t > vertexRemap( mesh.vertexCount );
+    WriteBitstream          output( 64 * 1024 );
+    MeshCompressionStats    stats;
+
+    CompressMesh( &mesh.triangles[ 0 ], mesh.triangleCount, &vertexRemap[ 0 ], mesh.vertexCount, mesh.vertexAttributeCount, &mesh.vertexAttributes[ 0 ], output, stats );
+
+    uint32_t edgeTriangles = stats.triangleCodes[ IB_EDGE_NEW ] + stats.triangleCodes[ IB_EDGE_CACHED ] + stats.triangleCodes[ IB_EDGE_FREE ];
+    uint64_t attributeBits = 0;
+
+    for ( uint32_t column = 0; column < MeshCompressionStats::MAX_ATTRIBUTE_COLUMNS; ++column )
+    {
+        attributeBits += stats.attributeBits[ column ];
+    }
+
+    printf( "%-20s edge %.1f%%, new new new %.1f%%, free vertices/tri %.3f, topology bits/tri %.3f, attribute bits/vert %.3f\n",
+            name,
+            ( 100.0 * edgeTriangles ) / mesh.triangleCount,
+            ( 100.0 * stats.triangleCodes[ IB_NEW_NEW_NEW ] ) / mesh.triangleCount,
+            static_cast< double >( stats.freeVertexCount ) / mesh.triangleCount,
+            static_cast< double >( stats.topologyBits ) / mesh.triangleCount,
+            static_cast< double >( attributeBits ) / mesh.vertexCount );
+}
+
+static void PrintResult( const char* name, const GeneratedMesh& mesh, const BenchmarkResult& result )
+{
+    double megabytes = static_cast< double >( result.decompressedBytes ) / ( 1024.0 * 1024.0 );
+
+    printf( "%-20s %-14s %12.0f %12.0f %12.0f %10.1f %10.3f %10.3f  %s\n",
+            mesh.name,
+            name,
+            mesh.triangleCount / result.compressSeconds,
+            result.countSeconds > 0 ? mesh.triangleCount / result.countSeconds : 0.0,
+            mesh.triangleCount / result.decompressSeconds,
+            megabytes / result.decompressSeconds,
+            static_cast< double >( result.compressedBits ) / mesh.triangleCount,
+            static_cast< double >( result.compressedBits ) / mesh.vertexCount,
+            result.verified ? "ok" : "MISMATCH" );
+}
+
+int main( int argc, char** argv )
+{
+    uint32_t targetTriangleCount  = argc > 1 ? static_cast< uint32_t >( atoi( argv[ 1 ] ) ) : 100000;
+    uint32_t vertexAttributeCount = argc > 2 ? static_cast< uint32_t >( atoi( argv[ 2 ] ) ) : 8;
+    uint32_t iterations           = argc > 3 ? static_cast< uint32_t >( atoi( argv[ 3 ] ) ) : 10;
+
+    if ( targetTriangleCount < 20 || vertexAttributeCount < 1 || vertexAttributeCount > MAX_ATTRIBUTE_COUNT || iterations < 1 )
+    {
+        fprintf( stderr, "usage: %s [target triangle count >= 20] [vertex attribute count 1..%u] [iterations]\n", argv[ 0 ], MAX_ATTRIBUTE_COUNT );
+        return 1;
+    }
+
+    MeshGeneratorParameters      parameters;
+    std::vector< GeneratedMesh > corpus;
+
+    // 14 bits keeps attributes (and their deltas) in range for the 16 bit attribute path.
+    parameters.vertexAttributeCount = vertexAttributeCount;
+    parameters.attributeBits        = 14;
+    parameters.seed                 = 1;
+
+    GenerateMeshCorpus( targetTriangleCount, parameters, corpus );
+
+    printf( "%u attributes per vertex, %u iterations\n\n", vertexAttributeCount, iterations );
+
+    bool verified = RunCorruptCodesBenchmark();
+
+    printf( "%-20s %-14s %12s %12s %12s %10s %10s %10s\n", "mesh", "indice/attrib", "enc tri/s", "count tri/s", "dec tri/s", "dec MB/s", "bits/tri", "bits/vert" );
+
+    for ( size_t meshIndex = 0; meshIndex < corpus.size(); ++meshIndex )
+    {
+        const GeneratedMesh& mesh = corpus[ meshIndex ];
+        BenchmarkResult      result;
+
+        printf( "%-20s %u triangles, %u vertices\n", mesh.name, mesh.triangleCount, mesh.vertexCount );
+
+        PrintStats( "", mesh );
+
+        // 16 bit indices can only address the first 65536 vertices.
+        if ( mesh.vertexCount <= 0x10000 )
+        {
+            result    = RunBenchmark< uint16_t, int32_t >( mesh, iterations );
+            verified &= result.verified;
+
+            PrintResult( "uint16/int32", mesh, result );
+        }
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations );
+        verified &= result.verified;
+
+        PrintResult( "uint32/int32", mesh, result );
+
+        if ( mesh.vertexCount <= 0x10000 )
+        {
+            result    = RunBenchmark< uint16_t, int16_t >( mesh, iterations );
+            verified &= result.verified;
+
+            PrintResult( "uint16/int16", mesh, result );
+        }
+
+        result    = RunBenchmark< uint32_t, int16_t >( mesh, iterations );
+        verified &= result.verified;
+
+        PrintResult( "uint32/int16", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_INCREMENTAL );
+        verified &= result.verified;
+
+        PrintResult( "incremental", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_CALLER_BUFFER );
+        verified &= result.verified;
+
+        PrintResult( "caller buffer", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_ARENA );
+        verified &= result.verified;
+
+        PrintResult( "arena", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_CURSOR_TABLE );
+        verified &= result.verified;
+
+        PrintResult( "cursor table", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_LONG_EDGES );
+        verified &= result.verified;
+
+        PrintResult( "long edges", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_FIFO_16 );
+        verified &= result.verified;
+
+        PrintResult( "fifo 16", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_FIFO_64 );
+        verified &= result.verified;
+
+        PrintResult( "fifo 64", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_ADAPTIVE_CODES );
+        verified &= result.verified;
+
+        PrintResult( "adaptive codes", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_TRIANGLE_CONTEXTS );
+        verified &= result.verified;
+
+        PrintResult( "tri contexts", mesh, result );
+
+        // Separate connectivity and attribute streams, fully decompressed, then connectivity only and connectivity with positions.
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_SEPARATE );
+        verified &= result.verified;
+
+        PrintResult( "separate", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_RANS );
+        verified &= result.verified;
+
+        PrintResult( "rans", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_TOPOLOGY );
+        verified &= result.verified;
+
+        PrintResult( "topology only", mesh, result );
+
+        result    = RunBenchmark< uint32_t, int32_t >( mesh, iterations, BM_POSITIONS );
+        verified &= result.verified;
+
+        PrintResult( "positions only", mesh, result );
+
+        // Independent chunks, decompressed on one thread and then on all of them.
+        result    = RunChunkedBenchmark< uint32_t, int32_t >( mesh, iterations, 1 );
+        verified &= result.verified;
+
+        PrintResult( "chunked x1", mesh, result );
+
+        result    = RunChunkedBenchmark< uint32_t, int32_t >( mesh, iterations, 0 );
+        verified &= result.verified;
+
+        PrintResult( "chunked xN", mesh, result );
+
+        verified &= RunSeekBenchmark( mesh );
+        verified &= RunSinkBenchmark( mesh );
+        verified &= RunHeaderBenchmark( mesh );
+
+        // The same mesh again, after reordering the triangles for the compressor.
+        GeneratedMesh reordered = mesh;
+        double        start     = Now();
+
+        ReorderTrianglesForCompression( &mesh.triangles[ 0 ], mesh.triangleCount, mesh.vertexCount, &reordered.triangles[ 0 ], NULL );
+
+        double reorderSeconds = Now() - start;
+
+        printf( "%-20s reordered in %.1f ms\n", "", reorderSeconds * 1000.0 );
+
+        PrintStats( "", reordered );
+
+        result    = RunBenchmark< uint32_t, int32_t >( reordered, iterations );
+        verified &= result.verified;
+
+        PrintResult( "reordered", reordered, result );
+    }
+
+    return verified ? 0 : 1;
+}
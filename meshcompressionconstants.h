@@ -27,6 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
 #include <stdint.h>
+#include "indexcompressionconstants.h"
 
 
 // This is the k sized used for encoding the first vertex in a NEW NEW NEW case.
@@ -34,6 +35,79 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // is definitely not optimal.
 const uint32_t EXP_GOLOMB_FIRST_NEW_K = 15;
 
+// Chunked mesh streams start with a table of 32 bit words; the trianglesPerChunk, chunk count and total vertex count, followed by
+// the byte offset (from the start of the table) and first vertex of each chunk. Each chunk is then a byte aligned stream
+// compressed like a separate mesh.
+const uint32_t MESH_CHUNK_HEADER_WORDS    = 3;
+const uint32_t MESH_CHUNK_WORDS_PER_CHUNK = 2;
+
+// Meshes compressed with MCF_MESH_HEADER start with MESH_HEADER_WORDS 32 bit words; MESH_HEADER_MAGIC, MESH_HEADER_VERSION, the
+// index and vertex attribute sizes in bytes the mesh was compressed from (index size in the low byte, attribute size in the next),
+// the triangle count, the vertex count of the decompressed mesh, the vertex attribute count and the MeshCompressionFlags that
+// affect the format (MCF_FORMAT_FLAGS and MCF_SEPARATE_STREAMS). The compressed mesh follows the header as it would without it.
+const uint32_t MESH_HEADER_WORDS   = 7;
+const uint32_t MESH_HEADER_MAGIC   = 0x484D434D; // "MCMH"
+const uint32_t MESH_HEADER_VERSION = 1;
+
+// Seek indices start with 3 32 bit words; the seek interval, the checkpoint count and the vertex attribute count. Each checkpoint
+// is then the bit offset (64 bits, as the low then the high word, so meshes over 512MB can be indexed), edges read, vertices read,
+// new vertices and lowest vertex referenced before the next checkpoint, followed by the edge FIFO (first, second and third for
+// each entry), the vertex FIFO and the k for each vertex attribute.
+const uint32_t MESH_SEEK_HEADER_WORDS   = 3;
+const uint32_t MESH_SEEK_CURSOR_WORDS   = 6;
+
+// Meshes compressed with MCF_SEPARATE_STREAMS start with 3 32 bit words; the vertex count, the vertex attribute count and the
+// MeshCompressionFlags that affect the format (MCF_FORMAT_FLAGS), followed by the byte offset (from the start of the table) of each
+// attribute column's stream. The connectivity stream starts straight after the table. Each stream is byte aligned and ends with
+// the usual 32 bits of padding.
+const uint32_t MESH_SEPARATE_HEADER_WORDS = 3;
+
+// With MCF_RANS_ATTRIBUTES, each attribute column's stream starts with a 32 bit word giving how its residuals are coded. Universal
+// coded columns carry on as they would without the flag.
+enum MeshResidualCoding
+{
+    MRC_UNIVERSAL = 0,
+    MRC_RANS      = 1
+};
+
+// rANS coded columns carry on with a 32 bit word giving the byte size of the rANS words, which are the initial state of each of
+// the RANS_LANE_COUNT interleaved decoders (32 bits each) followed by the 16 bit renormalisation words, in the order they are
+// read. Residual n is decoded by lane n % RANS_LANE_COUNT, and states are kept between RANS_STATE_LOWER_BOUND and 2^32.
+// After the words is a bitstream holding the symbol frequencies (the symbol count in RANS_SYMBOL_COUNT_BITS, then a bit for
+// whether each symbol is used and if so, its frequency - 1 in RANS_PROBABILITY_BITS), then the extra bits of each residual and then
+// 64 bits of padding.
+//
+// Residuals are zig-zag encoded and split into a symbol and extra bits. Values below RANS_DIRECT_RESIDUALS are their own
+// symbol, while larger values are classed by their highest set bit and the bit below it (2 symbols per bit length), with the
+// bits below those two as the extra bits.
+const uint32_t RANS_LANE_COUNT            = 4;
+const uint32_t RANS_PROBABILITY_BITS      = 12;
+const uint32_t RANS_STATE_LOWER_BOUND     = 1 << 16;
+const uint32_t RANS_DIRECT_RESIDUALS      = 16;
+const uint32_t RANS_RESIDUAL_SYMBOL_COUNT = 72;
+const uint32_t RANS_SYMBOL_COUNT_BITS     = 7;
+
+// Meshes compressed with MCF_ADAPTIVE_CODES start their connectivity with the canonical prefix code length (0 for unused symbols)
+// of each triangle code, then each edge FIFO position and then each cached vertex FIFO position, ADAPTIVE_CODE_LENGTH_BITS each.
+// IB_EDGE_0_NEW and IB_EDGE_1_NEW aren't prefix coded, so there are MESH_TRIANGLE_CODE_COUNT triangle codes.
+const uint32_t ADAPTIVE_CODE_LENGTH_BITS         = 4;
+const uint32_t ADAPTIVE_TRIANGLE_MAX_CODE_LENGTH = 8;
+const uint32_t ADAPTIVE_EDGE_MAX_CODE_LENGTH     = 11;
+const uint32_t ADAPTIVE_VERTEX_MAX_CODE_LENGTH   = 9;
+const uint32_t MESH_TRIANGLE_CODE_COUNT          = 14;
+
+// Meshes compressed with MCF_TRIANGLE_CONTEXTS store the triangle code lengths for each of MESH_TRIANGLE_CONTEXT_COUNT contexts
+// in turn (in place of the single set with MCF_ADAPTIVE_CODES), followed by the edge and cached vertex code lengths as usual. The
+// context for each triangle code comes from the previous triangle's code, with the first triangle in context 0.
+const uint32_t MESH_TRIANGLE_CONTEXT_COUNT = 4;
+
+// The context for the triangle code after one with the given code; 1 to 3 after IB_EDGE_NEW, IB_EDGE_CACHED and IB_EDGE_FREE,
+// which make up runs in strip-like regions, and 0 after the codes that start from new, cached or free vertices.
+inline uint32_t MeshTriangleCodeContext( IndexBufferTriangleCodes code )
+{
+    return code <= IB_EDGE_FREE ? static_cast< uint32_t >( code ) + 1 : 0;
+}
+
 // Edge in the edge fifo with an extra vertex for the opposing triangle.
 struct EdgeTriangle
 {
@@ -22,16 +22,17 @@ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
 (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
-#include "indexbufferdecompression.h"
+#include "meshdecompression.h"
+#include "meshcompression.h"
 #include "readbitstream.h"
+#include "writebitstream.h"
 #include "indexcompressionconstants.h"
 #include "indexbuffercompressionformat.h"
 #include "meshcompressionconstants.h"
+#include "meshparallel.h"
+#include "prefixcodebuilder.h"
 #include <assert.h>
-
-static const uint32_t EDGE_MAX_CODE_LENGTH     = 11;
-static const uint32_t VERTEX_MAX_CODE_LENGTH   = 8;
-static const uint32_t TRIANGLE_MAX_CODE_LENGTH = 7;
+#include <string.h>
 
 #ifdef _MSC_VER
 #define MDC_INLINE __forceinline
@@ -39,30 +40,247 @@ static const uint32_t TRIANGLE_MAX_CODE_LENGTH = 7;
 #define MDC_INLINE inline
 #endif 
 
+// The decoding tables and their maximum code lengths, generated from the encoding tables by meshtablegenerator.cpp.
 #include "indexbufferdecodetables.h"
 
-// Decompress triangle codes using prefix coding based on static tables.
-template <typename IndiceType, typename AttributeType>
-void DecompressMeshPrefix( 
-    IndiceType* triangles,
-    uint32_t triangleCount, 
-    uint32_t vertexAttributeCount,
-    AttributeType* vertexAttributes,
-    ReadBitstream& input2 )
+// The edge and cached vertex prefix code decoding tables (and their maximum code lengths) for each FIFO size.
+template < uint32_t FifoSize >
+struct FifoDecoding;
+
+template <>
+struct FifoDecoding< 16 >
 {
-    EdgeTriangle edgeFifo[ EDGE_FIFO_SIZE ];
-    uint32_t     vertexFifo[ VERTEX_FIFO_SIZE ];
-    ReadBitstream input( input2 );
+    static const uint32_t EDGE_MAX_CODE_LENGTH   = EDGE_16_MAX_CODE_LENGTH;
+    static const uint32_t VERTEX_MAX_CODE_LENGTH = VERTEX_16_MAX_CODE_LENGTH;
 
-    uint32_t          edgesRead    = 0;
-    uint32_t          verticesRead = 0;
-    uint32_t          newVertices  = 0;
-    const IndiceType* triangleEnd  = triangles + ( triangleCount * 3 );
-    AttributeType*    newVertex    = vertexAttributes;
+    static MDC_INLINE const PrefixCodeTableEntry* Edges() { return EdgeDecoding16; }
+    static MDC_INLINE const PrefixCodeTableEntry* CachedVertices() { return VertexDecoding16; }
+};
 
-    // array of exponential moving average values to estimate optimal k for exp golomb codes
-    // note we use 16/16 unsigned fixed point.
-    uint32_t kArray[ 64 ];
+template <>
+struct FifoDecoding< 32 >
+{
+    static const uint32_t EDGE_MAX_CODE_LENGTH   = ::EDGE_MAX_CODE_LENGTH;
+    static const uint32_t VERTEX_MAX_CODE_LENGTH = ::VERTEX_MAX_CODE_LENGTH;
+
+    static MDC_INLINE const PrefixCodeTableEntry* Edges() { return EdgeDecoding; }
+    static MDC_INLINE const PrefixCodeTableEntry* CachedVertices() { return VertexDecoding; }
+};
+
+template <>
+struct FifoDecoding< 64 >
+{
+    static const uint32_t EDGE_MAX_CODE_LENGTH   = EDGE_64_MAX_CODE_LENGTH;
+    static const uint32_t VERTEX_MAX_CODE_LENGTH = VERTEX_64_MAX_CODE_LENGTH;
+
+    static MDC_INLINE const PrefixCodeTableEntry* Edges() { return EdgeDecoding64; }
+    static MDC_INLINE const PrefixCodeTableEntry* CachedVertices() { return VertexDecoding64; }
+};
+
+// The triangle codes that are followed by an edge FIFO position, which are paired with it in the paired decoding tables.
+static const uint64_t EDGE_TRIANGLE_CODES = ( 1 << IB_EDGE_NEW ) | ( 1 << IB_EDGE_CACHED ) | ( 1 << IB_EDGE_FREE );
+
+// The paired triangle code and edge FIFO position decoding table for the fixed tables for the FIFO size, built from them the
+// first time it's used.
+template < uint32_t FifoSize >
+struct FixedPairedDecoding
+{
+    FixedPairedDecoding()
+    {
+        BuildPairedPrefixCodeDecodingTable(
+            TriangleDecoding,
+            TRIANGLE_MAX_CODE_LENGTH,
+            EDGE_TRIANGLE_CODES,
+            FifoDecoding< FifoSize >::Edges(),
+            FifoDecoding< FifoSize >::EDGE_MAX_CODE_LENGTH,
+            PAIRED_DECODING_CODE_LENGTH,
+            trianglesEdges );
+    }
+
+    static const PairedPrefixCodeTableEntry* TrianglesEdges()
+    {
+        static const FixedPairedDecoding decoding;
+
+        return decoding.trianglesEdges;
+    }
+
+    PairedPrefixCodeTableEntry trianglesEdges[ 1 << PAIRED_DECODING_CODE_LENGTH ];
+};
+
+// Prefix code decoding policy for the fixed tables for the FIFO size, where the tables and maximum code lengths are constants.
+template < uint32_t FifoSize >
+class FixedPrefixDecoding
+{
+public:
+
+    FixedPrefixDecoding() : m_trianglesEdges( FixedPairedDecoding< FifoSize >::TrianglesEdges() ) {}
+
+    MDC_INLINE const PairedPrefixCodeTableEntry* TrianglesEdges( uint32_t ) const { return m_trianglesEdges; }
+    MDC_INLINE const PrefixCodeTableEntry* Edges() const { return FifoDecoding< FifoSize >::Edges(); }
+    MDC_INLINE const PrefixCodeTableEntry* CachedVertices() const { return FifoDecoding< FifoSize >::CachedVertices(); }
+    MDC_INLINE uint32_t TriangleEdgeCodeLength() const { return PAIRED_DECODING_CODE_LENGTH; }
+    MDC_INLINE uint32_t EdgeMaxCodeLength() const { return FifoDecoding< FifoSize >::EDGE_MAX_CODE_LENGTH; }
+    MDC_INLINE uint32_t VertexMaxCodeLength() const { return FifoDecoding< FifoSize >::VERTEX_MAX_CODE_LENGTH; }
+    MDC_INLINE uint32_t TriangleContext( IndexBufferTriangleCodes ) const { return 0; }
+
+private:
+
+    const PairedPrefixCodeTableEntry* m_trianglesEdges;
+};
+
+// Prefix code decoding policy for the tables built for a mesh compressed with MCF_ADAPTIVE_CODES. The table pointers and lengths
+// are copied, so they can stay in registers rather than being reloaded around the output writes.
+class AdaptivePrefixDecoding
+{
+public:
+
+    AdaptivePrefixDecoding( const MeshAdaptiveDecoding& codes ) :
+        m_trianglesEdges( codes.trianglesEdges ),
+        m_edges( codes.edges ),
+        m_cachedVertices( codes.cachedVertices ),
+        m_edgeMaxCodeLength( codes.edgeMaxCodeLength ),
+        m_vertexMaxCodeLength( codes.vertexMaxCodeLength )
+    {
+    }
+
+    MDC_INLINE const PairedPrefixCodeTableEntry* TrianglesEdges( uint32_t ) const { return m_trianglesEdges; }
+    MDC_INLINE const PrefixCodeTableEntry* Edges() const { return m_edges; }
+    MDC_INLINE const PrefixCodeTableEntry* CachedVertices() const { return m_cachedVertices; }
+    MDC_INLINE uint32_t TriangleEdgeCodeLength() const { return PAIRED_DECODING_CODE_LENGTH; }
+    MDC_INLINE uint32_t EdgeMaxCodeLength() const { return m_edgeMaxCodeLength; }
+    MDC_INLINE uint32_t VertexMaxCodeLength() const { return m_vertexMaxCodeLength; }
+    MDC_INLINE uint32_t TriangleContext( IndexBufferTriangleCodes ) const { return 0; }
+
+protected:
+
+    const PairedPrefixCodeTableEntry* m_trianglesEdges;
+    const PrefixCodeTableEntry*       m_edges;
+    const PrefixCodeTableEntry*       m_cachedVertices;
+    uint32_t                          m_edgeMaxCodeLength;
+    uint32_t                          m_vertexMaxCodeLength;
+};
+
+// Prefix code decoding policy for a mesh compressed with MCF_TRIANGLE_CONTEXTS, which picks the paired triangle code table by the
+// context from the previous triangle code.
+class ContextPrefixDecoding : public AdaptivePrefixDecoding
+{
+public:
+
+    ContextPrefixDecoding( const MeshAdaptiveDecoding& codes ) : AdaptivePrefixDecoding( codes ) {}
+
+    MDC_INLINE const PairedPrefixCodeTableEntry* TrianglesEdges( uint32_t context ) const { return m_trianglesEdges + ( context << PAIRED_CONTEXT_DECODING_CODE_LENGTH ); }
+    MDC_INLINE uint32_t TriangleEdgeCodeLength() const { return PAIRED_CONTEXT_DECODING_CODE_LENGTH; }
+    MDC_INLINE uint32_t TriangleContext( IndexBufferTriangleCodes code ) const { return MeshTriangleCodeContext( code ); }
+};
+
+// Read the code lengths of one of the prefix codes stored with MCF_ADAPTIVE_CODES and build its decoding table, which has room
+// for codes up to tableCodeLength bits, setting the maximum code length. Returns false without building the table if a length
+// is longer than the table allows or the lengths don't make a prefix code (more codes of a length than the Kraft inequality
+// allows), as the stream is corrupt.
+static bool ReadAdaptiveCodes( ReadBitstream& input, uint32_t symbolCount, uint32_t tableCodeLength, PrefixCodeTableEntry* table, uint32_t& maxCodeLength )
+{
+    uint8_t  codeLengths[ MAX_PREFIX_CODE_SYMBOLS ];
+    uint32_t kraftSum = 0;
+
+    for ( uint32_t symbol = 0; symbol < symbolCount; ++symbol )
+    {
+        uint32_t codeLength = input.Read( ADAPTIVE_CODE_LENGTH_BITS );
+
+        if ( codeLength > tableCodeLength )
+        {
+            return false;
+        }
+
+        codeLengths[ symbol ] = static_cast< uint8_t >( codeLength );
+        kraftSum             += codeLength > 0 ? ( 1 << ( MAX_PREFIX_CODE_LENGTH - codeLength ) ) : 0;
+    }
+
+    if ( kraftSum > ( 1 << MAX_PREFIX_CODE_LENGTH ) )
+    {
+        return false;
+    }
+
+    maxCodeLength = BuildPrefixCodeDecodingTable( codeLengths, symbolCount, table );
+
+    return true;
+}
+
+// Read the code lengths at the start of a mesh compressed with MCF_ADAPTIVE_CODES (or MCF_TRIANGLE_CONTEXTS) and build its
+// decoding tables in the state. The triangle codes (for each context) come first, but their paired tables need the edge table.
+// Returns false if any of the code lengths are invalid.
+static bool ReadAdaptiveCodes( ReadBitstream& input, MeshDecompressionState& state )
+{
+    MeshAdaptiveDecoding& codes        = *state.adaptiveCodes;
+    uint32_t              fifoSize     = MeshFifoSize( state.flags );
+    uint32_t              contextCount = ( state.flags & MCF_TRIANGLE_CONTEXTS ) != 0 ? MESH_TRIANGLE_CONTEXT_COUNT : 1;
+    uint32_t              pairedLength = contextCount > 1 ? PAIRED_CONTEXT_DECODING_CODE_LENGTH : PAIRED_DECODING_CODE_LENGTH;
+    PrefixCodeTableEntry  triangles[ MESH_TRIANGLE_CONTEXT_COUNT ][ 1 << ADAPTIVE_TRIANGLE_MAX_CODE_LENGTH ];
+    uint32_t              triangleMaxCodeLengths[ MESH_TRIANGLE_CONTEXT_COUNT ];
+
+    for ( uint32_t context = 0; context < contextCount; ++context )
+    {
+        if ( !ReadAdaptiveCodes( input, MESH_TRIANGLE_CODE_COUNT, ADAPTIVE_TRIANGLE_MAX_CODE_LENGTH, triangles[ context ], triangleMaxCodeLengths[ context ] ) )
+        {
+            return false;
+        }
+    }
+
+    if ( !ReadAdaptiveCodes( input, fifoSize, ADAPTIVE_EDGE_MAX_CODE_LENGTH, codes.edges, codes.edgeMaxCodeLength ) ||
+         !ReadAdaptiveCodes( input, fifoSize, ADAPTIVE_VERTEX_MAX_CODE_LENGTH, codes.cachedVertices, codes.vertexMaxCodeLength ) )
+    {
+        return false;
+    }
+
+    for ( uint32_t context = 0; context < contextCount; ++context )
+    {
+        BuildPairedPrefixCodeDecodingTable(
+            triangles[ context ],
+            triangleMaxCodeLengths[ context ],
+            EDGE_TRIANGLE_CODES,
+            codes.edges,
+            codes.edgeMaxCodeLength,
+            pairedLength,
+            codes.trianglesEdges + ( context << pairedLength ) );
+    }
+
+    return true;
+}
+
+// The k for each vertex attribute column, which is in the scratch buffer for meshes with more attributes than kArray holds.
+static MDC_INLINE uint32_t* DecompressionKArray( MeshDecompressionState& state )
+{
+    return state.kScratch != NULL ? state.kScratch : state.kArray;
+}
+
+static MDC_INLINE const uint32_t* DecompressionKArray( const MeshDecompressionState& state )
+{
+    return state.kScratch != NULL ? state.kScratch : state.kArray;
+}
+
+// Set up the decompression state for the start of a mesh, reading the code lengths it starts with for MCF_ADAPTIVE_CODES (or
+// MCF_TRIANGLE_CONTEXTS) and building their decoding tables in adaptiveCodes, which is only touched for those flags. The attribute
+// scratch buffer is only needed (and used) for more than MESH_INLINE_ATTRIBUTE_COUNT attributes. Returns false if the code
+// lengths are invalid, in which case nothing should be decoded. Only the FIFO entries, counters and k estimates the mesh uses
+// are cleared, so setting up a small mesh stays cheap.
+static bool InitialiseDecompressionState( MeshDecompressionState& state, MeshAdaptiveDecoding* adaptiveCodes, uint32_t vertexAttributeCount, uint32_t flags, ReadBitstream& input, uint32_t* attributeScratch = NULL )
+{
+    assert( vertexAttributeCount <= MESH_INLINE_ATTRIBUTE_COUNT || attributeScratch != NULL );
+
+    uint32_t fifoSize = MeshFifoSize( flags );
+
+    ::memset( state.edgeFifo, 0, fifoSize * sizeof( EdgeTriangle ) );
+    ::memset( state.vertexFifo, 0, fifoSize * sizeof( uint32_t ) );
+
+    state.edgesRead       = 0;
+    state.verticesRead    = 0;
+    state.newVertices     = 0;
+    state.trianglesRead   = 0;
+    state.triangleContext = 0;
+    state.flags           = flags;
+    state.kScratch        = vertexAttributeCount > MESH_INLINE_ATTRIBUTE_COUNT ? attributeScratch : NULL;
+    state.adaptiveCodes   = NULL;
+
+    uint32_t* kArray = DecompressionKArray( state );
 
     for ( uint32_t where = 0; where < vertexAttributeCount; ++where )
     {
@@ -71,42 +289,298 @@ void DecompressMeshPrefix(
         kArray[ where ] = 4 << 16;
     }
 
-    // iterate through the triangles
-    for ( IndiceType* triangle = triangles; triangle < triangleEnd; triangle += 3 )
+    if ( ( flags & ( MCF_ADAPTIVE_CODES | MCF_TRIANGLE_CONTEXTS ) ) != 0 )
     {
-        IndexBufferTriangleCodes code = static_cast< IndexBufferTriangleCodes >( input.Decode( TriangleDecoding, TRIANGLE_MAX_CODE_LENGTH ) );
+        assert( adaptiveCodes != NULL );
 
-        switch ( code )
+        state.adaptiveCodes = adaptiveCodes;
+
+        return ReadAdaptiveCodes( input, state );
+    }
+
+    return true;
+}
+
+// Attribute decoder that decodes the attributes of new vertices as they are read, for the default format where they are
+// interleaved with the connectivity. New vertices are passed in by index, along with the vertices they are predicted from.
+// Meshes with more than MESH_INLINE_ATTRIBUTE_COUNT attributes work on the state's scratch buffer in place of a local copy.
+template <typename AttributeType>
+class InterleavedAttributeDecoder
+{
+public:
+
+    InterleavedAttributeDecoder( uint32_t vertexAttributeCount, AttributeType* vertexAttributes )
+        : m_vertexAttributeCount( vertexAttributeCount ), m_vertexAttributes( vertexAttributes ), m_kScratch( NULL ) {}
+
+    // Work on a local copy of the k estimates, so they don't alias with the output.
+    void Begin( const MeshDecompressionState& state )
+    {
+        m_kScratch = state.kScratch;
+
+        if ( m_kScratch == NULL )
         {
-        case IB_EDGE_NEW:
+            ::memcpy( m_kArray, state.kArray, m_vertexAttributeCount * sizeof( uint32_t ) );
+        }
+    }
+
+    void End( MeshDecompressionState& state ) const
+    {
+        if ( m_kScratch == NULL )
         {
-            uint32_t            edgeFifoIndex = input.Decode( EdgeDecoding, EDGE_MAX_CODE_LENGTH );
-            const EdgeTriangle& edge          = edgeFifo[ ( ( edgesRead - 1 ) - edgeFifoIndex ) & EDGE_FIFO_MASK ];
+            ::memcpy( state.kArray, m_kArray, m_vertexAttributeCount * sizeof( uint32_t ) );
+        }
+    }
 
-            triangle[ 0 ]                               = static_cast< IndiceType >( edge.second );
-            triangle[ 1 ]                               = static_cast< IndiceType >( edge.first );
+    // Parallelogram prediction from the edge the new vertex is attached to, updating the k estimates.
+    MDC_INLINE void EdgeNew( ReadBitstream& input, uint32_t newVertices, uint32_t adjacent1, uint32_t adjacent2, uint32_t opposing )
+    {
+        const uint32_t       attributeCount     = m_vertexAttributeCount;
+        AttributeType*       newVertex          = m_vertexAttributes + ( newVertices * attributeCount );
+        const AttributeType* adjacent1Attribute = m_vertexAttributes + ( adjacent1 * attributeCount );
+        const AttributeType* adjacent2Attribute = m_vertexAttributes + ( adjacent2 * attributeCount );
+        const AttributeType* opposingAttribute  = m_vertexAttributes + ( opposing * attributeCount );
+        AttributeType*       endAttributes      = newVertex + attributeCount;
+        uint32_t*            k                  = KArray();
+
+        for ( ; newVertex < endAttributes; ++adjacent1Attribute, ++adjacent2Attribute, ++opposingAttribute, ++newVertex, ++k )
+        {
+            uint32_t zigzagDelta = input.DecodeUniversal( *k >> 16 );
+            uint32_t kEstimate   = ReadBitstream::Log2( ( zigzagDelta << 1 ) | 1 );
 
-            vertexFifo[ verticesRead & EDGE_FIFO_MASK ] =
-            triangle[ 2 ]                               = static_cast< IndiceType >( newVertices );
+            *k = ( *k * 7 + ( kEstimate << 16 ) ) >> 3;
 
-            const AttributeType* adjacent1Attribute = vertexAttributes + ( edge.first * vertexAttributeCount );
-            const AttributeType* adjacent2Attribute = vertexAttributes + ( edge.second * vertexAttributeCount );
-            const AttributeType* opposingAttribute  = vertexAttributes + ( edge.third * vertexAttributeCount );
-            AttributeType*       endAttributes      = newVertex + vertexAttributeCount;
-            uint32_t*            k                  = kArray;
+            int32_t  delta     = ReadBitstream::DecodeZigZag( zigzagDelta );
+            int32_t  predicted = int32_t( *adjacent2Attribute ) + int32_t( *adjacent1Attribute ) - int32_t( *opposingAttribute );
 
-            for ( ; newVertex < endAttributes; ++adjacent1Attribute, ++adjacent2Attribute, ++opposingAttribute, ++newVertex, ++k )
-            {
-                uint32_t zigzagDelta = input.DecodeUniversal( *k >> 16 );
-                uint32_t kEstimate   = ReadBitstream::Log2( ( zigzagDelta << 1 ) | 1 );
+            *newVertex = static_cast< AttributeType >( predicted + delta );
+        }
+    }
 
-                *k = ( *k * 7 + ( kEstimate << 16 ) ) >> 3;
+    // Three new vertices, where the first is absolute and the other two are relative to it.
+    MDC_INLINE void NewNewNew( ReadBitstream& input, uint32_t newVertices )
+    {
+        const uint32_t  attributeCount = m_vertexAttributeCount;
+        AttributeType*  newVertex      = m_vertexAttributes + ( newVertices * attributeCount );
+        AttributeType*  vert0End       = newVertex + attributeCount;
+        const uint32_t* k              = KArray();
 
-                int32_t  delta     = ReadBitstream::DecodeZigZag( zigzagDelta );
-                int32_t  predicted = int32_t( *adjacent2Attribute ) + int32_t( *adjacent1Attribute ) - int32_t( *opposingAttribute );
+        for ( ; newVertex < vert0End; ++newVertex, ++k )
+        {
+            int32_t readVert0 = input.DecodeUniversalZigZag( EXP_GOLOMB_FIRST_NEW_K );
 
-                *newVertex = static_cast< AttributeType >( predicted + delta );
-            }
+            *newVertex                              = static_cast< AttributeType >( readVert0 );
+            *( newVertex + attributeCount )         = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert0 );
+            *( newVertex + ( 2 * attributeCount ) ) = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert0 );
+        }
+    }
+
+    // Two new vertices, both relative to the reference vertex.
+    MDC_INLINE void NewNew( ReadBitstream& input, uint32_t newVertices, uint32_t reference )
+    {
+        const uint32_t       attributeCount = m_vertexAttributeCount;
+        AttributeType*       newVertex      = m_vertexAttributes + ( newVertices * attributeCount );
+        const AttributeType* vert2          = m_vertexAttributes + ( reference * attributeCount );
+        const AttributeType* vert0End       = newVertex + attributeCount;
+        const uint32_t*      k              = KArray();
+
+        for ( ; newVertex < vert0End; ++newVertex, ++vert2, ++k )
+        {
+            int32_t readVert2 = *vert2;
+
+            *newVertex                      = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert2 );
+            *( newVertex + attributeCount ) = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert2 );
+        }
+    }
+
+    // One new vertex, relative to the reference vertex.
+    MDC_INLINE void New( ReadBitstream& input, uint32_t newVertices, uint32_t reference )
+    {
+        const uint32_t       attributeCount = m_vertexAttributeCount;
+        AttributeType*       newVertex      = m_vertexAttributes + ( newVertices * attributeCount );
+        const AttributeType* vert1          = m_vertexAttributes + ( reference * attributeCount );
+        const AttributeType* vert0End       = newVertex + attributeCount;
+        const uint32_t*      k              = KArray();
+
+        for ( ; newVertex < vert0End; ++newVertex, ++vert1, ++k )
+        {
+            *newVertex = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + *vert1 );
+        }
+    }
+
+private:
+
+    MDC_INLINE uint32_t* KArray() { return m_kScratch != NULL ? m_kScratch : m_kArray; }
+
+    uint32_t       m_vertexAttributeCount;
+    AttributeType* m_vertexAttributes;
+
+    // array of exponential moving average values to estimate optimal k for exp golomb codes
+    // note we use 16/16 unsigned fixed point.
+    uint32_t       m_kArray[ MESH_INLINE_ATTRIBUTE_COUNT ];
+    uint32_t*      m_kScratch;
+};
+
+// How a new vertex's attributes are predicted, recorded while decompressing the connectivity of a mesh with separate streams.
+enum VertexPredictionType
+{
+    // Parallelogram from references 0 (adjacent 1), 1 (adjacent 2) and 2 (opposing), updating the k estimate.
+    VP_PARALLELOGRAM = 0,
+
+    // Relative to reference 0.
+    VP_DELTA         = 1,
+
+    // Absolute, with EXP_GOLOMB_FIRST_NEW_K.
+    VP_ABSOLUTE      = 2
+};
+
+struct VertexPrediction
+{
+    uint32_t type;
+    uint32_t references[ 3 ];
+};
+
+// Attribute decoder for meshes with separate streams, which records how each new vertex is predicted, so that each attribute
+// column can be decompressed later on its own.
+class PredictionRecorder
+{
+public:
+
+    PredictionRecorder( VertexPrediction* predictions ) : m_predictions( predictions ) {}
+
+    void Begin( const MeshDecompressionState& ) {}
+    void End( MeshDecompressionState& ) const {}
+
+    MDC_INLINE void EdgeNew( ReadBitstream&, uint32_t newVertices, uint32_t adjacent1, uint32_t adjacent2, uint32_t opposing )
+    {
+        VertexPrediction& prediction = m_predictions[ newVertices ];
+
+        prediction.type            = VP_PARALLELOGRAM;
+        prediction.references[ 0 ] = adjacent1;
+        prediction.references[ 1 ] = adjacent2;
+        prediction.references[ 2 ] = opposing;
+    }
+
+    MDC_INLINE void NewNewNew( ReadBitstream&, uint32_t newVertices )
+    {
+        m_predictions[ newVertices ].type                = VP_ABSOLUTE;
+        m_predictions[ newVertices + 1 ].type            = VP_DELTA;
+        m_predictions[ newVertices + 1 ].references[ 0 ] = newVertices;
+        m_predictions[ newVertices + 2 ].type            = VP_DELTA;
+        m_predictions[ newVertices + 2 ].references[ 0 ] = newVertices;
+    }
+
+    MDC_INLINE void NewNew( ReadBitstream&, uint32_t newVertices, uint32_t reference )
+    {
+        m_predictions[ newVertices ].type                = VP_DELTA;
+        m_predictions[ newVertices ].references[ 0 ]     = reference;
+        m_predictions[ newVertices + 1 ].type            = VP_DELTA;
+        m_predictions[ newVertices + 1 ].references[ 0 ] = reference;
+    }
+
+    MDC_INLINE void New( ReadBitstream&, uint32_t newVertices, uint32_t reference )
+    {
+        m_predictions[ newVertices ].type            = VP_DELTA;
+        m_predictions[ newVertices ].references[ 0 ] = reference;
+    }
+
+private:
+
+    VertexPrediction* m_predictions;
+};
+
+// Attribute decoder for meshes with separate streams when only the connectivity is wanted.
+class NullAttributeDecoder
+{
+public:
+
+    void Begin( const MeshDecompressionState& ) {}
+    void End( MeshDecompressionState& ) const {}
+
+    MDC_INLINE void EdgeNew( ReadBitstream&, uint32_t, uint32_t, uint32_t, uint32_t ) {}
+    MDC_INLINE void NewNewNew( ReadBitstream&, uint32_t ) {}
+    MDC_INLINE void NewNew( ReadBitstream&, uint32_t, uint32_t ) {}
+    MDC_INLINE void New( ReadBitstream&, uint32_t, uint32_t ) {}
+};
+
+// Decode the edge of an edge coded triangle, from the edge FIFO or, for the long edge escape, from an earlier triangle
+// (triangle is the one being decoded, so the triangles before it have already been written).
+template <uint32_t FifoSize, typename CodesType, typename IndiceType>
+static MDC_INLINE const EdgeTriangle& DecodeEdge( ReadBitstream& input, const CodesType& codes, uint32_t pairedEdge, const EdgeTriangle* edgeFifo, uint32_t edgesRead, const IndiceType* triangle, bool longEdges, EdgeTriangle& longEdge )
+{
+    // The edge FIFO position has usually been decoded along with the triangle code already.
+    uint32_t edgeFifoIndex = pairedEdge != PREFIX_CODE_NOT_PAIRED ? pairedEdge : input.Decode( codes.Edges(), codes.EdgeMaxCodeLength() );
+
+    if ( edgeFifoIndex == LongEdgeEscape( FifoSize ) && longEdges )
+    {
+        uint32_t          reference  = input.ReadVInt();
+        uint32_t          edge       = reference % 3;
+        const IndiceType* referenced = triangle - ( ( reference - edge ) + 3 );
+
+        longEdge.set( referenced[ edge ], referenced[ edge == 2 ? 0 : edge + 1 ], referenced[ edge == 0 ? 2 : edge - 1 ] );
+
+        return longEdge;
+    }
+
+    return edgeFifo[ ( ( edgesRead - 1 ) - edgeFifoIndex ) & ( FifoSize - 1 ) ];
+}
+
+// Decompress triangle codes using prefix coding based on static tables, from the triangle the state is up to until lastTriangle.
+// Triangles are written at their position in the whole mesh, with new vertices passed to the attribute decoder.
+template <uint32_t FifoSize, typename CodesType, typename IndiceType, typename AttributeDecoderType>
+void DecodeMeshTrianglesFifo(
+    MeshDecompressionState& state,
+    CodesType codes,
+    IndiceType* triangles,
+    uint32_t lastTriangle,
+    const AttributeDecoderType& attributes2,
+    ReadBitstream& input2 )
+{
+    EdgeTriangle edgeFifo[ FifoSize ];
+    uint32_t     vertexFifo[ FifoSize ];
+    ReadBitstream input( input2 );
+
+    // Attribute decoders keep their state in the MeshDecompressionState between calls, so work on a local copy, where the compiler
+    // knows the k estimates don't alias with the output.
+    AttributeDecoderType attributes( attributes2 );
+
+    const uint32_t fifoMask = FifoSize - 1;
+
+    uint32_t          edgesRead       = state.edgesRead;
+    uint32_t          verticesRead    = state.verticesRead;
+    uint32_t          newVertices     = state.newVertices;
+    uint32_t          triangleContext = state.triangleContext;
+    const IndiceType* triangleEnd     = triangles + ( lastTriangle * 3 );
+    bool              longEdges       = ( state.flags & MCF_LONG_EDGES ) != 0;
+    EdgeTriangle      longEdge;
+
+    // Work on local copies of the state, so it doesn't alias with the output.
+    ::memcpy( edgeFifo, state.edgeFifo, sizeof( edgeFifo ) );
+    ::memcpy( vertexFifo, state.vertexFifo, sizeof( vertexFifo ) );
+
+    attributes.Begin( state );
+
+    // iterate through the triangles
+    for ( IndiceType* triangle = triangles + ( state.trianglesRead * 3 ); triangle < triangleEnd; triangle += 3 )
+    {
+        PairedPrefixCodeTableEntry codePair   = input.DecodePair( codes.TrianglesEdges( triangleContext ), codes.TriangleEdgeCodeLength() );
+        IndexBufferTriangleCodes   code       = static_cast< IndexBufferTriangleCodes >( codePair.first );
+        uint32_t                   pairedEdge = codePair.second;
+
+        triangleContext = codes.TriangleContext( code );
+
+        switch ( code )
+        {
+        case IB_EDGE_NEW:
+        {
+            const EdgeTriangle& edge = DecodeEdge< FifoSize >( input, codes, pairedEdge, edgeFifo, edgesRead, triangle, longEdges, longEdge );
+
+            triangle[ 0 ] = static_cast< IndiceType >( edge.second );
+            triangle[ 1 ] = static_cast< IndiceType >( edge.first );
+
+            vertexFifo[ verticesRead & fifoMask ] =
+            triangle[ 2 ]                         = static_cast< IndiceType >( newVertices );
+
+            attributes.EdgeNew( input, newVertices, edge.first, edge.second, edge.third );
 
             ++newVertices;
             ++verticesRead;
@@ -116,27 +590,25 @@ void DecompressMeshPrefix(
 
         case IB_EDGE_CACHED:
         {
-            uint32_t            edgeFifoIndex   = input.Decode( EdgeDecoding, EDGE_MAX_CODE_LENGTH );
-            uint32_t            vertexFifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
-            const EdgeTriangle& edge            = edgeFifo[ ( ( edgesRead - 1 ) - edgeFifoIndex ) & EDGE_FIFO_MASK ];
+            const EdgeTriangle& edge            = DecodeEdge< FifoSize >( input, codes, pairedEdge, edgeFifo, edgesRead, triangle, longEdges, longEdge );
+            uint32_t            vertexFifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
 
             triangle[ 0 ] = static_cast< IndiceType >( edge.second );
             triangle[ 1 ] = static_cast< IndiceType >( edge.first );
-            triangle[ 2 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & VERTEX_FIFO_MASK ] );
+            triangle[ 2 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & fifoMask ] );
 
             break;
         }
         case IB_EDGE_FREE:
         {
-            uint32_t            edgeFifoIndex   = input.Decode( EdgeDecoding, EDGE_MAX_CODE_LENGTH );
-            uint32_t            relativeVertex  = input.ReadVInt();
-            const EdgeTriangle& edge            = edgeFifo[ ( ( edgesRead - 1 ) - edgeFifoIndex ) & EDGE_FIFO_MASK ];
+            const EdgeTriangle& edge           = DecodeEdge< FifoSize >( input, codes, pairedEdge, edgeFifo, edgesRead, triangle, longEdges, longEdge );
+            uint32_t            relativeVertex = input.ReadVInt();
 
-            triangle[ 0 ]                                 = static_cast< IndiceType >( edge.second );
-            triangle[ 1 ]                                 = static_cast< IndiceType >( edge.first );
+            triangle[ 0 ] = static_cast< IndiceType >( edge.second );
+            triangle[ 1 ] = static_cast< IndiceType >( edge.first );
 
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );
+            vertexFifo[ verticesRead & fifoMask ] =
+            triangle[ 2 ]                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );
 
             ++verticesRead;
 
@@ -144,64 +616,39 @@ void DecompressMeshPrefix(
         }
         case IB_NEW_NEW_NEW:
         {
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 0 ]                                         = static_cast< IndiceType >( newVertices );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 1 ]                                         = static_cast< IndiceType >( newVertices + 1 );
-            vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                         = static_cast< IndiceType >( newVertices + 2 );
-            
-            const uint32_t* k        = kArray;
-
-            AttributeType* vert0End = newVertex + vertexAttributeCount;
-
-            for ( ; newVertex < vert0End; ++newVertex, ++k )
-            {
-                int32_t readVert0 = input.DecodeUniversalZigZag( EXP_GOLOMB_FIRST_NEW_K );
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 0 ]                                 = static_cast< IndiceType >( newVertices );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 1 ]                                 = static_cast< IndiceType >( newVertices + 1 );
+            vertexFifo[ ( verticesRead + 2 ) & fifoMask ] =
+            triangle[ 2 ]                                 = static_cast< IndiceType >( newVertices + 2 );
 
-                *newVertex                                    = static_cast< AttributeType >( readVert0 );
-                *( newVertex + vertexAttributeCount )         = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert0 );
-                *( newVertex + ( 2 * vertexAttributeCount ) ) = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert0 );
-            }
-            
-            newVertex += 2 * vertexAttributeCount;
+            attributes.NewNewNew( input, newVertices );
 
             newVertices  += 3;
             verticesRead += 3;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
             break;
         }
         case IB_NEW_NEW_CACHED:
         {
-            uint32_t vertexFifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
-
-            triangle[ 2 ]                                         = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & VERTEX_FIFO_MASK ] );
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 0 ]                                         = static_cast< IndiceType >( newVertices );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 1 ]                                         = static_cast< IndiceType >( newVertices + 1 );
-
-            const AttributeType* vert2    = vertexAttributes + ( triangle[ 2 ] * vertexAttributeCount );
-            const AttributeType* vert0End = newVertex + vertexAttributeCount;
-            const uint32_t*      k        = kArray;
-
-            for ( ; newVertex < vert0End; ++newVertex, ++vert2, ++k )
-            {
-                int32_t readVert2  = *vert2;
+            uint32_t vertexFifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
 
-                *newVertex                            = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert2 );
-                *( newVertex + vertexAttributeCount ) = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert2 );
-            }
+            triangle[ 2 ]                                 = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & fifoMask ] );
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 0 ]                                 = static_cast< IndiceType >( newVertices );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 1 ]                                 = static_cast< IndiceType >( newVertices + 1 );
 
-            newVertex += vertexAttributeCount;
+            attributes.NewNew( input, newVertices, triangle[ 2 ] );
 
             verticesRead += 2;
             newVertices  += 2;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
             break;
@@ -210,86 +657,60 @@ void DecompressMeshPrefix(
         {
             uint32_t relativeVertex = input.ReadVInt();
 
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 0 ]                                         = static_cast< IndiceType >( newVertices );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 1 ]                                         = static_cast< IndiceType >( newVertices + 1 );
-            vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );
-
-            const AttributeType* vert2    = vertexAttributes + ( triangle[ 2 ] * vertexAttributeCount );
-            const AttributeType* vert0End = newVertex + vertexAttributeCount;
-            const uint32_t*      k        = kArray;
-
-            for ( ; newVertex < vert0End; ++newVertex, ++vert2, ++k )
-            {
-                int32_t readVert2 = *vert2;
-
-                *newVertex                            = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert2 );
-                *( newVertex + vertexAttributeCount ) = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + readVert2 );
-            }
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 0 ]                                 = static_cast< IndiceType >( newVertices );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 1 ]                                 = static_cast< IndiceType >( newVertices + 1 );
+            vertexFifo[ ( verticesRead + 2 ) & fifoMask ] =
+            triangle[ 2 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );
 
-            newVertex += vertexAttributeCount;
+            attributes.NewNew( input, newVertices, triangle[ 2 ] );
 
             newVertices  += 2;
             verticesRead += 3;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
             break;
         }
         case IB_NEW_CACHED_CACHED:
         {
-            uint32_t vertex1FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
-            uint32_t vertex2FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
-
-            triangle[ 1 ]                                 = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex1FifoIndex ) & VERTEX_FIFO_MASK ] );
-            triangle[ 2 ]                                 = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex2FifoIndex ) & VERTEX_FIFO_MASK ] );
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ] =
-            triangle[ 0 ]                                 = static_cast< IndiceType >( newVertices );
+            uint32_t vertex1FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
+            uint32_t vertex2FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
 
-            const AttributeType* vert1    = vertexAttributes + ( triangle[ 1 ] * vertexAttributeCount );
-            const AttributeType* vert0End = newVertex + vertexAttributeCount;
-            const uint32_t*      k        = kArray;
+            triangle[ 1 ]                         = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex1FifoIndex ) & fifoMask ] );
+            triangle[ 2 ]                         = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex2FifoIndex ) & fifoMask ] );
+            vertexFifo[ verticesRead & fifoMask ] =
+            triangle[ 0 ]                         = static_cast< IndiceType >( newVertices );
 
-            for ( ; newVertex < vert0End; ++newVertex, ++vert1, ++k )
-            {
-                *newVertex = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + *vert1 );
-            }
+            attributes.New( input, newVertices, triangle[ 1 ] );
 
             ++verticesRead;
             ++newVertices;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
             break;
         }
         case IB_NEW_CACHED_FREE:
         {
-            uint32_t vertexFifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
+            uint32_t vertexFifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
             uint32_t relativeVertex  = input.ReadVInt();
 
-            triangle[ 1 ]                                         = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & VERTEX_FIFO_MASK ] );
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 0 ]                                         = static_cast< IndiceType >( newVertices );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );		
-
-            const AttributeType* vert1    = vertexAttributes + ( triangle[ 1 ] * vertexAttributeCount );
-            const AttributeType* vert0End = newVertex + vertexAttributeCount;
-            const uint32_t*      k        = kArray;
+            triangle[ 1 ]                                 = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & fifoMask ] );
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 0 ]                                 = static_cast< IndiceType >( newVertices );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 2 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );		
 
-            for ( ; newVertex < vert0End; ++newVertex, ++vert1, ++k )
-            {
-                *newVertex = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + *vert1 );
-            }
+            attributes.New( input, newVertices, triangle[ 1 ] );
 
             verticesRead += 2;
             ++newVertices;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
             break;
@@ -297,27 +718,20 @@ void DecompressMeshPrefix(
         case IB_NEW_FREE_CACHED:
         {
             uint32_t relativeVertex  = input.ReadVInt();
-            uint32_t vertexFifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
+            uint32_t vertexFifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
 
-            triangle[ 2 ]                                         = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & VERTEX_FIFO_MASK ] );
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 0 ]                                         = static_cast< IndiceType >( newVertices );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 1 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );				
-
-            const AttributeType* vert2    = vertexAttributes + ( triangle[ 2 ] * vertexAttributeCount );
-            const AttributeType* vert0End = newVertex + vertexAttributeCount;
-            const uint32_t*      k        = kArray;
+            triangle[ 2 ]                                 = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertexFifoIndex ) & fifoMask ] );
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 0 ]                                 = static_cast< IndiceType >( newVertices );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 1 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex );				
 
-            for ( ; newVertex < vert0End; ++newVertex, ++vert2, ++k )
-            {
-                *newVertex = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + *vert2 );
-            }
+            attributes.New( input, newVertices, triangle[ 2 ] );
 
             verticesRead += 2;
             ++newVertices;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
             break;
@@ -327,26 +741,19 @@ void DecompressMeshPrefix(
             uint32_t relativeVertex1  = input.ReadVInt();
             uint32_t relativeVertex2  = input.ReadVInt();
 
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 0 ]                                         = static_cast< IndiceType >( newVertices );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 1 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex1 );
-            vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 0 ]                                 = static_cast< IndiceType >( newVertices );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 1 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex1 );
+            vertexFifo[ ( verticesRead + 2 ) & fifoMask ] =
+            triangle[ 2 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
             
-            const AttributeType* vert1    = vertexAttributes + ( triangle[ 1 ] * vertexAttributeCount );
-            const AttributeType* vert0End = newVertex + vertexAttributeCount;
-            const uint32_t*      k        = kArray;
-
-            for ( ; newVertex < vert0End; ++newVertex, ++vert1, ++k )
-            {
-                *newVertex = static_cast< AttributeType >( input.DecodeUniversalZigZag( *k >> 16 ) + *vert1 );
-            }
+            attributes.New( input, newVertices, triangle[ 1 ] );
                         
             verticesRead += 3;
             ++newVertices;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
 
@@ -354,34 +761,34 @@ void DecompressMeshPrefix(
         }
         case IB_CACHED_CACHED_CACHED:
         {
-            uint32_t vertex0FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
-            uint32_t vertex1FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
-            uint32_t vertex2FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
+            uint32_t vertex0FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
+            uint32_t vertex1FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
+            uint32_t vertex2FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
 
-            triangle[ 0 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex0FifoIndex ) & VERTEX_FIFO_MASK ] );
-            triangle[ 1 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex1FifoIndex ) & VERTEX_FIFO_MASK ] );
-            triangle[ 2 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex2FifoIndex ) & VERTEX_FIFO_MASK ] );
+            triangle[ 0 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex0FifoIndex ) & fifoMask ] );
+            triangle[ 1 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex1FifoIndex ) & fifoMask ] );
+            triangle[ 2 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex2FifoIndex ) & fifoMask ] );
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
             break;
         }
         case IB_CACHED_CACHED_FREE:
         {
-            uint32_t vertex0FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
-            uint32_t vertex1FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
+            uint32_t vertex0FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
+            uint32_t vertex1FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
             uint32_t relativeVertex2  = input.ReadVInt();
 
-            triangle[ 0 ]                                 = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex0FifoIndex ) & VERTEX_FIFO_MASK ] );
-            triangle[ 1 ]                                 = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex1FifoIndex ) & VERTEX_FIFO_MASK ] );
+            triangle[ 0 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex0FifoIndex ) & fifoMask ] );
+            triangle[ 1 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex1FifoIndex ) & fifoMask ] );
 
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
+            vertexFifo[ verticesRead & fifoMask ] =
+            triangle[ 2 ]                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
 
             ++verticesRead;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
 
@@ -389,20 +796,20 @@ void DecompressMeshPrefix(
         }
         case IB_CACHED_FREE_FREE:
         {
-            uint32_t vertex0FifoIndex = input.Decode( VertexDecoding, VERTEX_MAX_CODE_LENGTH );
+            uint32_t vertex0FifoIndex = input.Decode( codes.CachedVertices(), codes.VertexMaxCodeLength() );
             uint32_t relativeVertex1  = input.ReadVInt();
             uint32_t relativeVertex2  = input.ReadVInt();
 
-            triangle[ 0 ]                                         = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex0FifoIndex ) & VERTEX_FIFO_MASK ] );
+            triangle[ 0 ] = static_cast< IndiceType >( vertexFifo[ ( ( verticesRead - 1 ) - vertex0FifoIndex ) & fifoMask ] );
 
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 1 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex1 );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 1 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex1 );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 2 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
 
             verticesRead += 2;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
 
@@ -414,78 +821,1203 @@ void DecompressMeshPrefix(
             uint32_t relativeVertex1 = input.ReadVInt();
             uint32_t relativeVertex2 = input.ReadVInt();
 
-            vertexFifo[ verticesRead & VERTEX_FIFO_MASK ]         =
-            triangle[ 0 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex0 );
-            vertexFifo[ ( verticesRead + 1 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 1 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex1 );
-            vertexFifo[ ( verticesRead + 2 ) & VERTEX_FIFO_MASK ] =
-            triangle[ 2 ]                                         = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
+            vertexFifo[ verticesRead & fifoMask ]         =
+            triangle[ 0 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex0 );
+            vertexFifo[ ( verticesRead + 1 ) & fifoMask ] =
+            triangle[ 1 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex1 );
+            vertexFifo[ ( verticesRead + 2 ) & fifoMask ] =
+            triangle[ 2 ]                                 = static_cast< IndiceType >( ( newVertices - 1 ) - relativeVertex2 );
 
             verticesRead += 3;
 
-            edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
+            edgeFifo[ edgesRead & fifoMask ].set( triangle[ 0 ], triangle[ 1 ], triangle[ 2 ] );
 
             ++edgesRead;
 
             break;
-        }		
+        }
+        case IB_EDGE_0_NEW:
+        case IB_EDGE_1_NEW:
+        {
+            // These codes are never prefix coded, so a valid stream can't produce them.
+            assert( false );
+            break;
+        }
         }
 
-        edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 1 ], triangle[ 2 ], triangle[ 0 ] );
+        edgeFifo[ edgesRead & fifoMask ].set( triangle[ 1 ], triangle[ 2 ], triangle[ 0 ] );
 
         ++edgesRead;
 
-        edgeFifo[ edgesRead & EDGE_FIFO_MASK ].set( triangle[ 2 ], triangle[ 0 ], triangle[ 1 ] );
+        edgeFifo[ edgesRead & fifoMask ].set( triangle[ 2 ], triangle[ 0 ], triangle[ 1 ] );
 
         ++edgesRead;
     }
 
-    // Skip over padding at the end, put in so a short prefix code (1 bit) doesn't cause an overflow
-    input.Read( 32 );
+    ::memcpy( state.edgeFifo, edgeFifo, sizeof( edgeFifo ) );
+    ::memcpy( state.vertexFifo, vertexFifo, sizeof( vertexFifo ) );
+
+    attributes.End( state );
+
+    state.edgesRead       = edgesRead;
+    state.verticesRead    = verticesRead;
+    state.newVertices     = newVertices;
+    state.trianglesRead   = lastTriangle;
+    state.triangleContext = triangleContext;
 
     input2 = input;
 }
 
-// 32 bit indice/32bit attribute decompression
-void DecompressMesh( 
-    uint32_t* triangles,
-    uint32_t triangleCount,
-    uint32_t vertexAttributeCount,
-    int32_t* vertexAttributes,
+// Decode triangles with the fixed prefix codes for the FIFO size, or the ones built for the mesh with MCF_ADAPTIVE_CODES or
+// MCF_TRIANGLE_CONTEXTS.
+template <uint32_t FifoSize, typename IndiceType, typename AttributeDecoderType>
+void DecodeMeshTrianglesCodes(
+    MeshDecompressionState& state,
+    IndiceType* triangles,
+    uint32_t lastTriangle,
+    AttributeDecoderType& attributes,
     ReadBitstream& input )
 {
-    DecompressMeshPrefix<uint32_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input );
+    if ( ( state.flags & MCF_TRIANGLE_CONTEXTS ) != 0 )
+    {
+        DecodeMeshTrianglesFifo< FifoSize >( state, ContextPrefixDecoding( *state.adaptiveCodes ), triangles, lastTriangle, attributes, input );
+    }
+    else if ( ( state.flags & MCF_ADAPTIVE_CODES ) != 0 )
+    {
+        DecodeMeshTrianglesFifo< FifoSize >( state, AdaptivePrefixDecoding( *state.adaptiveCodes ), triangles, lastTriangle, attributes, input );
+    }
+    else
+    {
+        DecodeMeshTrianglesFifo< FifoSize >( state, FixedPrefixDecoding< FifoSize >(), triangles, lastTriangle, attributes, input );
+    }
 }
 
-// 16 bit indice/32bit attribute decompression
-void DecompressMesh(
-    uint16_t* triangles,
+// Decode triangles with the FIFO size the mesh was compressed with (from the format flags in the state).
+template <typename IndiceType, typename AttributeDecoderType>
+void DecodeMeshTriangles(
+    MeshDecompressionState& state,
+    IndiceType* triangles,
+    uint32_t lastTriangle,
+    AttributeDecoderType& attributes,
+    ReadBitstream& input )
+{
+    switch ( MeshFifoSize( state.flags ) )
+    {
+    case 16:
+
+        DecodeMeshTrianglesCodes< 16 >( state, triangles, lastTriangle, attributes, input );
+        break;
+
+    case 64:
+
+        DecodeMeshTrianglesCodes< 64 >( state, triangles, lastTriangle, attributes, input );
+        break;
+
+    default:
+
+        DecodeMeshTrianglesCodes< 32 >( state, triangles, lastTriangle, attributes, input );
+        break;
+    }
+}
+
+// Decompress triangles and their attributes in the default interleaved format, from the triangle the state is up to until
+// lastTriangle. Triangles and new vertices are written at their position in the whole mesh.
+template <typename IndiceType, typename AttributeType>
+void DecompressMeshTriangles(
+    MeshDecompressionState& state,
+    IndiceType* triangles,
+    uint32_t lastTriangle,
+    uint32_t vertexAttributeCount,
+    AttributeType* vertexAttributes,
+    ReadBitstream& input )
+{
+    InterleavedAttributeDecoder< AttributeType > attributes( vertexAttributeCount, vertexAttributes );
+
+    DecodeMeshTriangles( state, triangles, lastTriangle, attributes, input );
+}
+
+// Decompress a whole mesh, returning false if the code lengths at the start of the mesh are invalid.
+template <typename IndiceType, typename AttributeType>
+bool DecompressMeshPrefix( 
+    IndiceType* triangles,
+    uint32_t triangleCount, 
+    uint32_t vertexAttributeCount,
+    AttributeType* vertexAttributes,
+    ReadBitstream& input,
+    uint32_t flags,
+    uint32_t* attributeScratch )
+{
+    MeshDecompressionState state;
+    MeshAdaptiveDecoding   adaptiveCodes;
+
+    if ( !InitialiseDecompressionState( state, &adaptiveCodes, vertexAttributeCount, flags, input, attributeScratch ) )
+    {
+        return false;
+    }
+
+    DecompressMeshTriangles( state, triangles, triangleCount, vertexAttributeCount, vertexAttributes, input );
+
+    // Skip over padding at the end, put in so a short prefix code (1 bit) doesn't cause an overflow
+    input.Read( 32 );
+
+    return true;
+}
+
+MeshDecompressor::MeshDecompressor( uint32_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int32_t* vertexAttributes, ReadBitstream& input, uint32_t flags, uint32_t* attributeScratch )
+    : m_input( input )
+{
+    Initialise( MDF_UINT32_INT32, triangles, triangleCount, vertexAttributeCount, vertexAttributes, flags, attributeScratch );
+}
+
+MeshDecompressor::MeshDecompressor( uint16_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int32_t* vertexAttributes, ReadBitstream& input, uint32_t flags, uint32_t* attributeScratch )
+    : m_input( input )
+{
+    Initialise( MDF_UINT16_INT32, triangles, triangleCount, vertexAttributeCount, vertexAttributes, flags, attributeScratch );
+}
+
+MeshDecompressor::MeshDecompressor( uint32_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int16_t* vertexAttributes, ReadBitstream& input, uint32_t flags, uint32_t* attributeScratch )
+    : m_input( input )
+{
+    Initialise( MDF_UINT32_INT16, triangles, triangleCount, vertexAttributeCount, vertexAttributes, flags, attributeScratch );
+}
+
+MeshDecompressor::MeshDecompressor( uint16_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int16_t* vertexAttributes, ReadBitstream& input, uint32_t flags, uint32_t* attributeScratch )
+    : m_input( input )
+{
+    Initialise( MDF_UINT16_INT16, triangles, triangleCount, vertexAttributeCount, vertexAttributes, flags, attributeScratch );
+}
+
+void MeshDecompressor::Initialise( OutputFormat format, void* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, void* vertexAttributes, uint32_t flags, uint32_t* attributeScratch )
+{
+    m_format               = format;
+    m_triangles            = triangles;
+    m_triangleCount        = triangleCount;
+    m_vertexAttributeCount = vertexAttributeCount;
+    m_vertexAttributes     = vertexAttributes;
+
+    m_valid = InitialiseDecompressionState( m_state, &m_adaptiveCodes, vertexAttributeCount, flags, m_input, attributeScratch );
+
+    // Nothing to decode, so skip the padding straight away.
+    if ( triangleCount == 0 && m_valid )
+    {
+        m_input.Read( 32 );
+    }
+}
+
+uint32_t MeshDecompressor::DecodeTriangles( uint32_t count )
+{
+    uint32_t trianglesLeft = m_triangleCount - m_state.trianglesRead;
+
+    if ( count > trianglesLeft )
+    {
+        count = trianglesLeft;
+    }
+
+    if ( count == 0 || !m_valid )
+    {
+        return 0;
+    }
+
+    uint32_t lastTriangle = m_state.trianglesRead + count;
+
+    switch ( m_format )
+    {
+    case MDF_UINT32_INT32:
+
+        DecompressMeshTriangles( m_state, static_cast< uint32_t* >( m_triangles ), lastTriangle, m_vertexAttributeCount, static_cast< int32_t* >( m_vertexAttributes ), m_input );
+        break;
+
+    case MDF_UINT16_INT32:
+
+        DecompressMeshTriangles( m_state, static_cast< uint16_t* >( m_triangles ), lastTriangle, m_vertexAttributeCount, static_cast< int32_t* >( m_vertexAttributes ), m_input );
+        break;
+
+    case MDF_UINT32_INT16:
+
+        DecompressMeshTriangles( m_state, static_cast< uint32_t* >( m_triangles ), lastTriangle, m_vertexAttributeCount, static_cast< int16_t* >( m_vertexAttributes ), m_input );
+        break;
+
+    case MDF_UINT16_INT16:
+
+        DecompressMeshTriangles( m_state, static_cast< uint16_t* >( m_triangles ), lastTriangle, m_vertexAttributeCount, static_cast< int16_t* >( m_vertexAttributes ), m_input );
+        break;
+    }
+
+    if ( IsFinished() )
+    {
+        // Skip over padding at the end, as with DecompressMesh.
+        m_input.Read( 32 );
+    }
+
+    return count;
+}
+
+// 32 bit indice/32bit attribute decompression
+bool DecompressMesh( 
+    uint32_t* triangles,
     uint32_t triangleCount,
     uint32_t vertexAttributeCount,
     int32_t* vertexAttributes,
-    ReadBitstream& input )
+    ReadBitstream& input,
+    uint32_t flags,
+    uint32_t* attributeScratch )
+{
+    return DecompressMeshPrefix<uint32_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input, flags, attributeScratch );
+}
+
+// 16 bit indice/32bit attribute decompression
+bool DecompressMesh(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    ReadBitstream& input,
+    uint32_t flags,
+    uint32_t* attributeScratch )
 {
-    DecompressMeshPrefix<uint16_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input );
+    return DecompressMeshPrefix<uint16_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input, flags, attributeScratch );
 }
 
 // 32 bit indice/32bit attribute decompression
-void DecompressMesh(
+bool DecompressMesh(
     uint32_t* triangles,
     uint32_t triangleCount,
     uint32_t vertexAttributeCount,
     int16_t* vertexAttributes,
-    ReadBitstream& input )
+    ReadBitstream& input,
+    uint32_t flags,
+    uint32_t* attributeScratch )
 {
-    DecompressMeshPrefix<uint32_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input );
+    return DecompressMeshPrefix<uint32_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input, flags, attributeScratch );
 }
 
 // 16 bit indice/32bit attribute decompression
-void DecompressMesh(
+bool DecompressMesh(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    ReadBitstream& input,
+    uint32_t flags,
+    uint32_t* attributeScratch )
+{
+    return DecompressMeshPrefix<uint16_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input, flags, attributeScratch );
+}
+
+// Read a 32 bit little endian word from a table (chunk tables and seek indices).
+static MDC_INLINE uint32_t ReadWord( const uint8_t* table, uint32_t word )
+{
+    const uint8_t* bytes = table + ( word * 4 );
+
+    return bytes[ 0 ] | ( bytes[ 1 ] << 8 ) | ( bytes[ 2 ] << 16 ) | ( static_cast< uint32_t >( bytes[ 3 ] ) << 24 );
+}
+
+bool QueryCompressedMesh( const uint8_t* compressedData, size_t compressedSize, CompressedMeshInfo& info )
+{
+    if ( compressedSize < MESH_HEADER_WORDS * 4 ||
+         ReadWord( compressedData, 0 ) != MESH_HEADER_MAGIC ||
+         ReadWord( compressedData, 1 ) != MESH_HEADER_VERSION )
+    {
+        return false;
+    }
+
+    uint32_t layout = ReadWord( compressedData, 2 );
+
+    info.version              = MESH_HEADER_VERSION;
+    info.headerSize           = MESH_HEADER_WORDS * 4;
+    info.indexSize            = layout & 0xFF;
+    info.attributeSize        = ( layout >> 8 ) & 0xFF;
+    info.triangleCount        = ReadWord( compressedData, 3 );
+    info.vertexCount          = ReadWord( compressedData, 4 );
+    info.vertexAttributeCount = ReadWord( compressedData, 5 );
+    info.flags                = ReadWord( compressedData, 6 );
+
+    return true;
+}
+
+uint32_t GetMeshChunkCount( const uint8_t* compressedData )
+{
+    return ReadWord( compressedData, 1 );
+}
+
+uint32_t GetMeshChunkedVertexCount( const uint8_t* compressedData )
+{
+    return ReadWord( compressedData, 2 );
+}
+
+// Decompress a single chunk of a chunked mesh in place.
+template <typename IndiceType, typename AttributeType>
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    AttributeType* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    assert( chunkIndex < GetMeshChunkCount( compressedData ) );
+
+    uint32_t          trianglesPerChunk  = ReadWord( compressedData, 0 );
+    uint32_t          chunkWord          = MESH_CHUNK_HEADER_WORDS + ( chunkIndex * MESH_CHUNK_WORDS_PER_CHUNK );
+    uint32_t          chunkOffset        = ReadWord( compressedData, chunkWord );
+    uint32_t          firstVertex        = ReadWord( compressedData, chunkWord + 1 );
+    uint32_t          firstTriangle      = chunkIndex * trianglesPerChunk;
+    uint32_t          chunkTriangleCount = triangleCount - firstTriangle < trianglesPerChunk ? triangleCount - firstTriangle : trianglesPerChunk;
+    IndiceType*       chunkTriangles     = triangles + ( firstTriangle * 3 );
+    const IndiceType* chunkTrianglesEnd  = chunkTriangles + ( chunkTriangleCount * 3 );
+
+    ReadBitstream input( compressedData + chunkOffset, compressedSize - chunkOffset );
+
+    // Chunks can be decompressed at the same time, so each gets its own attribute scratch if the mesh needs one.
+    uint32_t* attributeScratch = vertexAttributeCount > MESH_INLINE_ATTRIBUTE_COUNT ? new uint32_t[ vertexAttributeCount ] : NULL;
+
+    // Chunks are compressed without MCF_ADAPTIVE_CODES, so there are no code lengths to fail on.
+    DecompressMeshPrefix<IndiceType, AttributeType>( chunkTriangles, chunkTriangleCount, vertexAttributeCount, vertexAttributes + ( firstVertex * vertexAttributeCount ), input, 0, attributeScratch );
+
+    delete[] attributeScratch;
+
+    // Chunks are decompressed with their own vertex numbering, so offset them to where the chunk's vertices are.
+    if ( firstVertex > 0 )
+    {
+        for ( IndiceType* indice = chunkTriangles; indice < chunkTrianglesEnd; ++indice )
+        {
+            *indice = static_cast< IndiceType >( *indice + firstVertex );
+        }
+    }
+}
+
+// Decompress a chunk of a chunked mesh, called from RunParallel.
+template <typename IndiceType, typename AttributeType>
+struct DecompressMeshChunkJob
+{
+    void operator()( uint32_t chunkIndex )
+    {
+        DecompressMeshChunk<IndiceType, AttributeType>( chunkIndex, triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize );
+    }
+
+    IndiceType*    triangles;
+    uint32_t       triangleCount;
+    uint32_t       vertexAttributeCount;
+    AttributeType* vertexAttributes;
+    const uint8_t* compressedData;
+    size_t         compressedSize;
+};
+
+template <typename IndiceType, typename AttributeType>
+void DecompressMeshChunked(
+    IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    AttributeType* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    DecompressMeshChunkJob<IndiceType, AttributeType> job;
+
+    job.triangles            = triangles;
+    job.triangleCount        = triangleCount;
+    job.vertexAttributeCount = vertexAttributeCount;
+    job.vertexAttributes     = vertexAttributes;
+    job.compressedData       = compressedData;
+    job.compressedSize       = compressedSize;
+
+    RunParallel( GetMeshChunkCount( compressedData ), threadCount, job );
+}
+
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    DecompressMeshChunk<uint32_t, int32_t>( chunkIndex, triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize );
+}
+
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    DecompressMeshChunk<uint16_t, int32_t>( chunkIndex, triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize );
+}
+
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    DecompressMeshChunk<uint32_t, int16_t>( chunkIndex, triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize );
+}
+
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    DecompressMeshChunk<uint16_t, int16_t>( chunkIndex, triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize );
+}
+
+void DecompressMeshChunked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    DecompressMeshChunked<uint32_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+void DecompressMeshChunked(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    DecompressMeshChunked<uint16_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+void DecompressMeshChunked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    DecompressMeshChunked<uint32_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+void DecompressMeshChunked(
     uint16_t* triangles,
     uint32_t triangleCount,
     uint32_t vertexAttributeCount,
     int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    DecompressMeshChunked<uint16_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+uint32_t GetMeshSeparateVertexCount( const uint8_t* compressedData )
+{
+    return ReadWord( compressedData, 0 );
+}
+
+// Decompress the connectivity stream of a mesh with separate streams, passing new vertices to the attribute decoder. Returns false
+// if the code lengths at the start of the stream are invalid.
+template <typename IndiceType, typename AttributeDecoderType>
+bool DecompressMeshSeparateTopology(
+    IndiceType* triangles,
+    uint32_t triangleCount,
+    AttributeDecoderType& attributes,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    uint32_t               topologyOffset = ( MESH_SEPARATE_HEADER_WORDS + ReadWord( compressedData, 1 ) ) * 4;
+    MeshDecompressionState state;
+    MeshAdaptiveDecoding   adaptiveCodes;
+    ReadBitstream          input( compressedData + topologyOffset, compressedSize - topologyOffset );
+
+    if ( !InitialiseDecompressionState( state, &adaptiveCodes, 0, ReadWord( compressedData, 2 ), input ) )
+    {
+        return false;
+    }
+
+    DecodeMeshTriangles( state, triangles, triangleCount, attributes, input );
+
+    return true;
+}
+
+// Decompress a single attribute column of a mesh with separate streams, using the predictions recorded while decompressing
+// the connectivity. Values are written every outputStride entries from output.
+template <typename AttributeType>
+void DecompressAttributeColumn(
+    const VertexPrediction* predictions,
+    uint32_t vertexCount,
+    AttributeType* output,
+    uint32_t outputStride,
     ReadBitstream& input )
 {
-    DecompressMeshPrefix<uint16_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, input );
+    const VertexPrediction* predictionsEnd = predictions + vertexCount;
+    AttributeType*          newVertex      = output;
+
+    // exponential moving average to estimate the optimal k for exp golomb codes, in 16/16 unsigned fixed point.
+    uint32_t k = 4 << 16;
+
+    for ( const VertexPrediction* prediction = predictions; prediction < predictionsEnd; ++prediction, newVertex += outputStride )
+    {
+        switch ( prediction->type )
+        {
+        case VP_PARALLELOGRAM:
+        {
+            uint32_t zigzagDelta = input.DecodeUniversal( k >> 16 );
+            uint32_t kEstimate   = ReadBitstream::Log2( ( zigzagDelta << 1 ) | 1 );
+
+            k = ( k * 7 + ( kEstimate << 16 ) ) >> 3;
+
+            int32_t delta     = ReadBitstream::DecodeZigZag( zigzagDelta );
+            int32_t predicted = int32_t( output[ prediction->references[ 1 ] * outputStride ] ) +
+                                int32_t( output[ prediction->references[ 0 ] * outputStride ] ) -
+                                int32_t( output[ prediction->references[ 2 ] * outputStride ] );
+
+            *newVertex = static_cast< AttributeType >( predicted + delta );
+            break;
+        }
+        case VP_DELTA:
+
+            *newVertex = static_cast< AttributeType >( input.DecodeUniversalZigZag( k >> 16 ) + output[ prediction->references[ 0 ] * outputStride ] );
+            break;
+
+        case VP_ABSOLUTE:
+
+            *newVertex = static_cast< AttributeType >( input.DecodeUniversalZigZag( EXP_GOLOMB_FIRST_NEW_K ) );
+            break;
+        }
+    }
+}
+
+// The number of residuals decoded at a time from a rANS coded column (a multiple of RANS_LANE_COUNT).
+static const uint32_t RANS_RESIDUAL_BLOCK_SIZE = 256;
+
+// Decodes the zig-zag encoded residuals of an attribute column coded with rANS, for MCF_RANS_ATTRIBUTES (see MeshResidualCoding
+// for the format). The residuals are decoded in blocks, where each group of RANS_LANE_COUNT residuals is decoded by independent
+// states, so their table lookups and multiplies can overlap.
+class RansResidualDecoder
+{
+public:
+
+    // Starts after the column's coding word.
+    RansResidualDecoder( const uint8_t* data, size_t dataSize )
+        : m_words( data + 4 + RANS_LANE_COUNT * 4 ),
+          m_input( data + 4 + ReadWord( data, 0 ), dataSize - 4 - ReadWord( data, 0 ) )
+    {
+        for ( uint32_t lane = 0; lane < RANS_LANE_COUNT; ++lane )
+        {
+            m_states[ lane ] = ReadWord( data, 1 + lane );
+        }
+
+        uint32_t symbolCount = m_input.Read( RANS_SYMBOL_COUNT_BITS );
+        uint32_t slot        = 0;
+
+        // Each slot packs the frequency (13 bits), the slot's offset from the start of its symbol (12 bits) and the symbol (7 bits).
+        for ( uint32_t symbol = 0; symbol < symbolCount && symbol < RANS_RESIDUAL_SYMBOL_COUNT; ++symbol )
+        {
+            uint32_t frequency = m_input.Read( 1 ) != 0 ? m_input.Read( RANS_PROBABILITY_BITS ) + 1 : 0;
+
+            for ( uint32_t offset = 0; offset < frequency && slot < ( 1 << RANS_PROBABILITY_BITS ); ++offset, ++slot )
+            {
+                m_slots[ slot ] = ( frequency << 19 ) | ( offset << 7 ) | symbol;
+            }
+        }
+
+        for ( ; slot < ( 1 << RANS_PROBABILITY_BITS ); ++slot )
+        {
+            m_slots[ slot ] = 0;
+        }
+
+        for ( uint32_t symbol = 0; symbol < RANS_RESIDUAL_SYMBOL_COUNT; ++symbol )
+        {
+            uint32_t topBit = ( ( symbol - RANS_DIRECT_RESIDUALS ) >> 1 ) + ReadBitstream::Log2( RANS_DIRECT_RESIDUALS );
+
+            m_extraBitCounts[ symbol ] = symbol < RANS_DIRECT_RESIDUALS ? 0 : topBit - 1;
+            m_bases[ symbol ]          = symbol < RANS_DIRECT_RESIDUALS ? symbol : ( 2 | ( symbol & 1 ) ) << ( topBit - 1 );
+        }
+    }
+
+    // Decode the next count residuals. Every call but the last must decode a multiple of RANS_LANE_COUNT.
+    void Decode( uint32_t* residuals, uint32_t count )
+    {
+        uint32_t residual = 0;
+
+        for ( ; residual + RANS_LANE_COUNT <= count; residual += RANS_LANE_COUNT )
+        {
+            uint32_t symbols[ RANS_LANE_COUNT ];
+
+            for ( uint32_t lane = 0; lane < RANS_LANE_COUNT; ++lane )
+            {
+                symbols[ lane ] = DecodeSymbol( m_states[ lane ] );
+            }
+
+            for ( uint32_t lane = 0; lane < RANS_LANE_COUNT; ++lane )
+            {
+                residuals[ residual + lane ] = m_bases[ symbols[ lane ] ] | m_input.Read( m_extraBitCounts[ symbols[ lane ] ] );
+            }
+        }
+
+        for ( ; residual < count; ++residual )
+        {
+            uint32_t symbol = DecodeSymbol( m_states[ residual % RANS_LANE_COUNT ] );
+
+            residuals[ residual ] = m_bases[ symbol ] | m_input.Read( m_extraBitCounts[ symbol ] );
+        }
+    }
+
+private:
+
+    MDC_INLINE uint32_t DecodeSymbol( uint32_t& state )
+    {
+        uint32_t slot = m_slots[ state & ( ( 1 << RANS_PROBABILITY_BITS ) - 1 ) ];
+
+        state = ( slot >> 19 ) * ( state >> RANS_PROBABILITY_BITS ) + ( ( slot >> 7 ) & ( ( 1 << RANS_PROBABILITY_BITS ) - 1 ) );
+
+        if ( state < RANS_STATE_LOWER_BOUND )
+        {
+            state    = ( state << 16 ) | m_words[ 0 ] | ( m_words[ 1 ] << 8 );
+            m_words += 2;
+        }
+
+        return slot & 0x7F;
+    }
+
+    uint32_t       m_states[ RANS_LANE_COUNT ];
+    const uint8_t* m_words;
+    ReadBitstream  m_input;
+    uint32_t       m_slots[ 1 << RANS_PROBABILITY_BITS ];
+    uint32_t       m_bases[ RANS_RESIDUAL_SYMBOL_COUNT ];
+    uint32_t       m_extraBitCounts[ RANS_RESIDUAL_SYMBOL_COUNT ];
+};
+
+// Same as DecompressAttributeColumn, but for a column coded with rANS.
+template <typename AttributeType>
+void DecompressAttributeColumnRans(
+    const VertexPrediction* predictions,
+    uint32_t vertexCount,
+    AttributeType* output,
+    uint32_t outputStride,
+    RansResidualDecoder& input )
+{
+    uint32_t       residuals[ RANS_RESIDUAL_BLOCK_SIZE ];
+    AttributeType* newVertex = output;
+
+    for ( uint32_t blockStart = 0; blockStart < vertexCount; blockStart += RANS_RESIDUAL_BLOCK_SIZE )
+    {
+        uint32_t                blockSize      = vertexCount - blockStart < RANS_RESIDUAL_BLOCK_SIZE ? vertexCount - blockStart : RANS_RESIDUAL_BLOCK_SIZE;
+        const VertexPrediction* prediction     = predictions + blockStart;
+        const VertexPrediction* predictionsEnd = prediction + blockSize;
+        const uint32_t*         residual       = residuals;
+
+        input.Decode( residuals, blockSize );
+
+        for ( ; prediction < predictionsEnd; ++prediction, ++residual, newVertex += outputStride )
+        {
+            int32_t delta = ReadBitstream::DecodeZigZag( *residual );
+
+            switch ( prediction->type )
+            {
+            case VP_PARALLELOGRAM:
+
+                *newVertex = static_cast< AttributeType >( int32_t( output[ prediction->references[ 1 ] * outputStride ] ) +
+                                                           int32_t( output[ prediction->references[ 0 ] * outputStride ] ) -
+                                                           int32_t( output[ prediction->references[ 2 ] * outputStride ] ) + delta );
+                break;
+
+            case VP_DELTA:
+
+                *newVertex = static_cast< AttributeType >( delta + output[ prediction->references[ 0 ] * outputStride ] );
+                break;
+
+            case VP_ABSOLUTE:
+
+                *newVertex = static_cast< AttributeType >( delta );
+                break;
+            }
+        }
+    }
+}
+
+// Decompress an attribute column of a mesh with separate streams, called from RunParallel with the index of the output column.
+template <typename AttributeType>
+struct DecompressAttributeColumnJob
+{
+    void operator()( uint32_t outputColumn )
+    {
+        uint32_t column       = columns != NULL ? columns[ outputColumn ] : outputColumn;
+        uint32_t columnOffset = ReadWord( compressedData, MESH_SEPARATE_HEADER_WORDS + column );
+        uint32_t coding       = MRC_UNIVERSAL;
+
+        if ( ( flags & MCF_RANS_ATTRIBUTES ) != 0 )
+        {
+            coding        = ReadWord( compressedData + columnOffset, 0 );
+            columnOffset += 4;
+        }
+
+        if ( coding == MRC_RANS )
+        {
+            RansResidualDecoder input( compressedData + columnOffset, compressedSize - columnOffset );
+
+            DecompressAttributeColumnRans( predictions, vertexCount, vertexAttributes + outputColumn, outputColumnCount, input );
+        }
+        else
+        {
+            ReadBitstream input( compressedData + columnOffset, compressedSize - columnOffset );
+
+            DecompressAttributeColumn( predictions, vertexCount, vertexAttributes + outputColumn, outputColumnCount, input );
+        }
+    }
+
+    const VertexPrediction* predictions;
+    uint32_t                vertexCount;
+
+    // The source column for each output column, or NULL when every column is decompressed.
+    const uint32_t*         columns;
+    uint32_t                outputColumnCount;
+    uint32_t                flags;
+    AttributeType*          vertexAttributes;
+    const uint8_t*          compressedData;
+    size_t                  compressedSize;
+};
+
+// Decompress a mesh with separate streams, with outputColumnCount attribute columns decompressed (packed together), where
+// columns gives the source column of each (NULL for every column in order). The streams for the other columns aren't read at all.
+// Returns false, without decompressing any attributes, if the code lengths at the start of the connectivity are invalid.
+template <typename IndiceType, typename AttributeType>
+bool DecompressMeshColumns(
+    IndiceType* triangles,
+    uint32_t triangleCount,
+    const uint32_t* columns,
+    uint32_t outputColumnCount,
+    AttributeType* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    if ( outputColumnCount == 0 )
+    {
+        NullAttributeDecoder attributes;
+
+        return DecompressMeshSeparateTopology( triangles, triangleCount, attributes, compressedData, compressedSize );
+    }
+
+    uint32_t           vertexCount = GetMeshSeparateVertexCount( compressedData );
+    VertexPrediction*  predictions = new VertexPrediction[ vertexCount ];
+    PredictionRecorder recorder( predictions );
+
+    if ( !DecompressMeshSeparateTopology( triangles, triangleCount, recorder, compressedData, compressedSize ) )
+    {
+        delete[] predictions;
+        return false;
+    }
+
+    DecompressAttributeColumnJob< AttributeType > job;
+
+    job.predictions       = predictions;
+    job.vertexCount       = vertexCount;
+    job.columns           = columns;
+    job.outputColumnCount = outputColumnCount;
+    job.flags             = ReadWord( compressedData, 2 );
+    job.vertexAttributes  = vertexAttributes;
+    job.compressedData    = compressedData;
+    job.compressedSize    = compressedSize;
+
+    RunParallel( outputColumnCount, threadCount, job );
+
+    delete[] predictions;
+
+    return true;
+}
+
+// Decompress a mesh with separate streams, with only the attribute columns in attributeMask decompressed (packed together in
+// column order).
+template <typename IndiceType, typename AttributeType>
+bool DecompressMeshMasked(
+    IndiceType* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    AttributeType* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    uint32_t vertexAttributeCount = ReadWord( compressedData, 1 );
+    uint32_t columns[ 64 ];
+    uint32_t outputColumnCount    = 0;
+
+    for ( uint32_t column = 0; column < vertexAttributeCount && column < 64; ++column )
+    {
+        if ( ( attributeMask >> column ) & 1 )
+        {
+            columns[ outputColumnCount++ ] = column;
+        }
+    }
+
+    return DecompressMeshColumns( triangles, triangleCount, columns, outputColumnCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+template <typename IndiceType, typename AttributeType>
+bool DecompressMeshSeparate(
+    IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    AttributeType* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    assert( ReadWord( compressedData, 1 ) == vertexAttributeCount );
+
+    return DecompressMeshColumns( triangles, triangleCount, NULL, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshTopology(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    NullAttributeDecoder attributes;
+
+    return DecompressMeshSeparateTopology( triangles, triangleCount, attributes, compressedData, compressedSize );
+}
+
+bool DecompressMeshTopology(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    const uint8_t* compressedData,
+    size_t compressedSize )
+{
+    NullAttributeDecoder attributes;
+
+    return DecompressMeshSeparateTopology( triangles, triangleCount, attributes, compressedData, compressedSize );
+}
+
+bool DecompressMeshSeparate(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshSeparate<uint32_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshSeparate(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshSeparate<uint16_t, int32_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshSeparate(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshSeparate<uint32_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshSeparate(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshSeparate<uint16_t, int16_t>( triangles, triangleCount, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshMasked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshMasked<uint32_t, int32_t>( triangles, triangleCount, attributeMask, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshMasked(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshMasked<uint16_t, int32_t>( triangles, triangleCount, attributeMask, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshMasked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshMasked<uint32_t, int16_t>( triangles, triangleCount, attributeMask, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+bool DecompressMeshMasked(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount )
+{
+    return DecompressMeshMasked<uint16_t, int16_t>( triangles, triangleCount, attributeMask, vertexAttributes, compressedData, compressedSize, threadCount );
+}
+
+// Number of words for each checkpoint in a seek index.
+static MDC_INLINE uint32_t SeekCheckpointWords( uint32_t vertexAttributeCount )
+{
+    return MESH_SEEK_CURSOR_WORDS + ( EDGE_FIFO_SIZE * 3 ) + VERTEX_FIFO_SIZE + vertexAttributeCount;
+}
+
+static MDC_INLINE const uint8_t* SeekCheckpoint( const uint8_t* seekIndex, uint32_t checkpoint )
+{
+    return seekIndex + ( ( MESH_SEEK_HEADER_WORDS + ( checkpoint * SeekCheckpointWords( ReadWord( seekIndex, 2 ) ) ) ) * 4 );
+}
+
+void BuildMeshSeekIndex(
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    uint32_t seekInterval,
+    WriteBitstream& seekIndex )
+{
+    assert( seekInterval > 0 );
+
+    uint32_t               checkpointCount  = ( triangleCount + seekInterval - 1 ) / seekInterval;
+    uint32_t*              triangles        = new uint32_t[ triangleCount * 3 ];
+    int32_t*               vertexAttributes = new int32_t[ vertexCount * vertexAttributeCount ];
+    uint32_t*              attributeScratch = vertexAttributeCount > MESH_INLINE_ATTRIBUTE_COUNT ? new uint32_t[ vertexAttributeCount ] : NULL;
+    uint32_t*              checkpointKArray = new uint32_t[ vertexAttributeCount ];
+    MeshDecompressionState state;
+    ReadBitstream          input( compressedData, compressedSize );
+
+    InitialiseDecompressionState( state, NULL, vertexAttributeCount, 0, input, attributeScratch );
+
+    seekIndex.Write( seekInterval, 32 );
+    seekIndex.Write( checkpointCount, 32 );
+    seekIndex.Write( vertexAttributeCount, 32 );
+
+    for ( uint32_t checkpoint = 0; checkpoint < checkpointCount; ++checkpoint )
+    {
+        MeshDecompressionState checkpointState = state;
+        size_t                 bitOffset       = input.Position();
+        uint32_t               firstTriangle   = checkpoint * seekInterval;
+        uint32_t               lastTriangle    = triangleCount - firstTriangle < seekInterval ? triangleCount : firstTriangle + seekInterval;
+        uint32_t               lowestVertex    = 0xFFFFFFFF;
+
+        // The k can be in the scratch buffer, which the copy of the state shares, so keep them separately.
+        ::memcpy( checkpointKArray, DecompressionKArray( state ), vertexAttributeCount * sizeof( uint32_t ) );
+
+        DecompressMeshTriangles<uint32_t, int32_t>( state, triangles, lastTriangle, vertexAttributeCount, vertexAttributes, input );
+
+        for ( const uint32_t* indice = triangles + ( firstTriangle * 3 ); indice < triangles + ( lastTriangle * 3 ); ++indice )
+        {
+            lowestVertex = *indice < lowestVertex ? *indice : lowestVertex;
+        }
+
+        seekIndex.Write( static_cast< uint32_t >( bitOffset ), 32 );
+        seekIndex.Write( static_cast< uint32_t >( static_cast< uint64_t >( bitOffset ) >> 32 ), 32 );
+        seekIndex.Write( checkpointState.edgesRead, 32 );
+        seekIndex.Write( checkpointState.verticesRead, 32 );
+        seekIndex.Write( checkpointState.newVertices, 32 );
+        seekIndex.Write( lowestVertex, 32 );
+
+        for ( uint32_t edge = 0; edge < EDGE_FIFO_SIZE; ++edge )
+        {
+            seekIndex.Write( checkpointState.edgeFifo[ edge ].first, 32 );
+            seekIndex.Write( checkpointState.edgeFifo[ edge ].second, 32 );
+            seekIndex.Write( checkpointState.edgeFifo[ edge ].third, 32 );
+        }
+
+        for ( uint32_t vertex = 0; vertex < VERTEX_FIFO_SIZE; ++vertex )
+        {
+            seekIndex.Write( checkpointState.vertexFifo[ vertex ], 32 );
+        }
+
+        for ( uint32_t attribute = 0; attribute < vertexAttributeCount; ++attribute )
+        {
+            seekIndex.Write( checkpointKArray[ attribute ], 32 );
+        }
+    }
+
+    delete[] checkpointKArray;
+    delete[] attributeScratch;
+    delete[] vertexAttributes;
+    delete[] triangles;
+}
+
+void GetMeshRangeDependencies(
+    const uint8_t* seekIndex,
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint32_t& lowestVertex,
+    uint32_t& firstDecodedVertex )
+{
+    uint32_t seekInterval    = ReadWord( seekIndex, 0 );
+    uint32_t firstCheckpoint = firstTriangle / seekInterval;
+    uint32_t lastCheckpoint  = ( lastTriangle + seekInterval - 1 ) / seekInterval;
+
+    assert( firstTriangle < lastTriangle && lastCheckpoint <= ReadWord( seekIndex, 1 ) );
+
+    firstDecodedVertex = ReadWord( SeekCheckpoint( seekIndex, firstCheckpoint ), 4 );
+    lowestVertex       = 0xFFFFFFFF;
+
+    for ( uint32_t checkpoint = firstCheckpoint; checkpoint < lastCheckpoint; ++checkpoint )
+    {
+        uint32_t checkpointLowest = ReadWord( SeekCheckpoint( seekIndex, checkpoint ), 5 );
+
+        lowestVertex = checkpointLowest < lowestVertex ? checkpointLowest : lowestVertex;
+    }
+}
+
+// Decompress from the checkpoint before firstTriangle up to lastTriangle.
+template <typename IndiceType, typename AttributeType>
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    IndiceType* triangles,
+    uint32_t vertexAttributeCount,
+    AttributeType* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex )
+{
+    assert( vertexAttributeCount == ReadWord( seekIndex, 2 ) );
+    assert( firstTriangle <= lastTriangle );
+
+    uint32_t               seekInterval = ReadWord( seekIndex, 0 );
+    uint32_t               checkpoint   = firstTriangle / seekInterval;
+    const uint8_t*         cursor       = SeekCheckpoint( seekIndex, checkpoint );
+    uint64_t               bitOffset    = ReadWord( cursor, 0 ) | ( static_cast< uint64_t >( ReadWord( cursor, 1 ) ) << 32 );
+    size_t                 byteOffset   = static_cast< size_t >( bitOffset >> 3 );
+    MeshDecompressionState state;
+
+    assert( checkpoint < ReadWord( seekIndex, 1 ) );
+
+    state.trianglesRead   = checkpoint * seekInterval;
+    state.edgesRead       = ReadWord( cursor, 2 );
+    state.verticesRead    = ReadWord( cursor, 3 );
+    state.newVertices     = ReadWord( cursor, 4 );
+    state.triangleContext = 0;
+    state.flags           = 0;
+    state.kScratch        = vertexAttributeCount > MESH_INLINE_ATTRIBUTE_COUNT ? new uint32_t[ vertexAttributeCount ] : NULL;
+    state.adaptiveCodes   = NULL;
+
+    cursor += MESH_SEEK_CURSOR_WORDS * 4;
+
+    for ( uint32_t edge = 0; edge < EDGE_FIFO_SIZE; ++edge, cursor += 12 )
+    {
+        state.edgeFifo[ edge ].set( ReadWord( cursor, 0 ), ReadWord( cursor, 1 ), ReadWord( cursor, 2 ) );
+    }
+
+    for ( uint32_t vertex = 0; vertex < VERTEX_FIFO_SIZE; ++vertex, cursor += 4 )
+    {
+        state.vertexFifo[ vertex ] = ReadWord( cursor, 0 );
+    }
+
+    uint32_t* kArray = DecompressionKArray( state );
+
+    for ( uint32_t attribute = 0; attribute < vertexAttributeCount; ++attribute, cursor += 4 )
+    {
+        kArray[ attribute ] = ReadWord( cursor, 0 );
+    }
+
+    ReadBitstream input( compressedData + byteOffset, compressedSize - byteOffset );
+
+    input.Read( static_cast< uint32_t >( bitOffset & 7 ) );
+
+    DecompressMeshTriangles<IndiceType, AttributeType>( state, triangles, lastTriangle, vertexAttributeCount, vertexAttributes, input );
+
+    delete[] state.kScratch;
+}
+
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint32_t* triangles,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex )
+{
+    DecompressMeshRange<uint32_t, int32_t>( firstTriangle, lastTriangle, triangles, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, seekIndex );
+}
+
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint16_t* triangles,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex )
+{
+    DecompressMeshRange<uint16_t, int32_t>( firstTriangle, lastTriangle, triangles, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, seekIndex );
+}
+
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint32_t* triangles,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex )
+{
+    DecompressMeshRange<uint32_t, int16_t>( firstTriangle, lastTriangle, triangles, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, seekIndex );
+}
+
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint16_t* triangles,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex )
+{
+    DecompressMeshRange<uint16_t, int16_t>( firstTriangle, lastTriangle, triangles, vertexAttributeCount, vertexAttributes, compressedData, compressedSize, seekIndex );
 }
@@ -28,6 +28,83 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdint.h>
 #include "readbitstream.h"
+#include "indexcompressionconstants.h"
+#include "meshcompressionconstants.h"
+
+class WriteBitstream;
+
+// Triangle codes are decoded with paired tables, which also decode the edge FIFO position after an edge code when it fits in the
+// table's bits, so the most common triangles take a single lookup. This is the number of bits looked up at a time, which is
+// less with MCF_TRIANGLE_CONTEXTS, as there is a table for each context.
+const uint32_t PAIRED_DECODING_CODE_LENGTH         = 12;
+const uint32_t PAIRED_CONTEXT_DECODING_CODE_LENGTH = 10;
+
+// Prefix code decoding tables built from the code lengths at the start of a mesh compressed with MCF_ADAPTIVE_CODES. With
+// MCF_TRIANGLE_CONTEXTS, there is a paired table for each context, each 2^PAIRED_CONTEXT_DECODING_CODE_LENGTH entries. These
+// are kept out of the MeshDecompressionState, as they are only built (and touched) for meshes with those flags.
+struct MeshAdaptiveDecoding
+{
+    PairedPrefixCodeTableEntry trianglesEdges[ 1 << PAIRED_DECODING_CODE_LENGTH ];
+    PrefixCodeTableEntry       edges[ 1 << ADAPTIVE_EDGE_MAX_CODE_LENGTH ];
+    PrefixCodeTableEntry       cachedVertices[ 1 << ADAPTIVE_VERTEX_MAX_CODE_LENGTH ];
+    uint32_t                   edgeMaxCodeLength;
+    uint32_t                   vertexMaxCodeLength;
+};
+
+// The decompressor's state between triangles, which is everything needed to carry on decompressing from a point in the stream.
+struct MeshDecompressionState
+{
+    // The edge and vertex FIFOs, of which only the first MeshFifoSize( flags ) entries are used.
+    EdgeTriangle edgeFifo[ MAX_FIFO_SIZE ];
+    uint32_t     vertexFifo[ MAX_FIFO_SIZE ];
+    uint32_t     edgesRead;
+    uint32_t     verticesRead;
+    uint32_t     newVertices;
+    uint32_t     trianglesRead;
+
+    // The context for the next triangle code, with MCF_TRIANGLE_CONTEXTS.
+    uint32_t     triangleContext;
+
+    // The MeshCompressionFlags the mesh was compressed with (only MCF_FORMAT_FLAGS matter to the decompressor).
+    uint32_t     flags;
+
+    // Exponential moving average for the k of each vertex attribute column (16.16 fixed point).
+    uint32_t     kArray[ MESH_INLINE_ATTRIBUTE_COUNT ];
+
+    // For meshes with more than MESH_INLINE_ATTRIBUTE_COUNT attributes, the caller's scratch buffer that holds the k for each
+    // column in place of kArray (NULL otherwise).
+    uint32_t*    kScratch;
+
+    // The decoding tables for MCF_ADAPTIVE_CODES and MCF_TRIANGLE_CONTEXTS, owned by whoever set up the state (NULL otherwise).
+    MeshAdaptiveDecoding* adaptiveCodes;
+};
+
+// The description of a mesh compressed with MCF_MESH_HEADER, from QueryCompressedMesh.
+struct CompressedMeshInfo
+{
+    // The header version and its size in bytes. The compressed mesh starts headerSize bytes after the start of the header.
+    uint32_t version;
+    uint32_t headerSize;
+
+    // The size in bytes of the indices and vertex attributes the mesh was compressed from (2 or 4 each).
+    uint32_t indexSize;
+    uint32_t attributeSize;
+
+    uint32_t triangleCount;
+
+    // The number of vertices in the decompressed mesh (vertices that aren't used by any triangle aren't compressed).
+    uint32_t vertexCount;
+    uint32_t vertexAttributeCount;
+
+    // The MeshCompressionFlags that affect the format (MCF_FORMAT_FLAGS and MCF_SEPARATE_STREAMS), which pick the decompression
+    // call and are passed to it. These describe the format actually written, so MCF_RANS_ATTRIBUTES is only set along with
+    // MCF_SEPARATE_STREAMS, and MCF_TRIANGLE_CONTEXTS always comes with MCF_ADAPTIVE_CODES.
+    uint32_t flags;
+};
+
+// Read the header of a mesh compressed with MCF_MESH_HEADER, without decompressing anything. Returns false if compressedData
+// doesn't start with a header of a version this understands, or compressedSize is too small to hold one.
+bool QueryCompressedMesh( const uint8_t* compressedData, size_t compressedSize, CompressedMeshInfo& info );
 
 // Decompress a triangle mesh, consisting of a set of vertices, referenced by a list of triangles (indices)
 // The vertices consist of a set of vertex attributes, all are int32_ts.
@@ -35,42 +112,420 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // All vertex attributes use delta coding using either a parallelogram predictor (for edge cache hits)
 // or another vertex in the triangle (except for NEW NEW NEW cases, where the first vertex is encoded in absolute terms).
 // Recommended maximum range for attributes is -2^29 to 2^29 - 1. 
+// Returns false, without decompressing any triangles, if the prefix code lengths a mesh compressed with MCF_ADAPTIVE_CODES (or
+// MCF_TRIANGLE_CONTEXTS) starts with are invalid, as they are for a corrupt stream or the wrong flags.
 // Parameters: 
 //     [out] triangles            - Triangle list index buffer (3 indices to vertices per triangle), output from the decompression - 16bit indices
 //     [in]  triangleCount        - The number of triangles to decompress.
 //     [in]  vertexAttributeCount - The number of attributes per vertex
 //     [out] vertexAttributes     - The decompressed vertex attributes.
 //     [in]  input                - The bit stream that the compressed data will be read from.
-void DecompressMesh(
+//     [in]  flags                - The MeshCompressionFlags the mesh was compressed with. Only the ones that change the format
+//                                  (MCF_FORMAT_FLAGS) matter, and they must match the ones used for compression.
+//     [in]  attributeScratch     - Scratch space for vertexAttributeCount words, which must be given for meshes with more than
+//                                  MESH_INLINE_ATTRIBUTE_COUNT attributes (decompression never allocates for it). Can be NULL otherwise.
+bool DecompressMesh(
     uint32_t* triangles,
     uint32_t triangleCount,
     uint32_t vertexAttributeCount,
     int32_t* vertexAttributes,
-    ReadBitstream& input );
+    ReadBitstream& input,
+    uint32_t flags = 0,
+    uint32_t* attributeScratch = NULL );
 
 // Same as above but 16 bit indices.
-void DecompressMesh(
+bool DecompressMesh(
     uint16_t* triangles,
     uint32_t triangleCount,
     uint32_t vertexAttributeCount,
     int32_t* vertexAttributes,
-    ReadBitstream& input );
+    ReadBitstream& input,
+    uint32_t flags = 0,
+    uint32_t* attributeScratch = NULL );
 
 // Same as above but 32 bit indices and 16 bit vertex attributes. 
-void DecompressMesh(
+bool DecompressMesh(
     uint32_t* triangles,
     uint32_t triangleCount,
     uint32_t vertexAttributeCount,
     int16_t* vertexAttributes,
-    ReadBitstream& input );
+    ReadBitstream& input,
+    uint32_t flags = 0,
+    uint32_t* attributeScratch = NULL );
 
 // Same as above but 32 bit indices.
-void DecompressMesh(
+bool DecompressMesh(
     uint16_t* triangles,
     uint32_t triangleCount,
     uint32_t vertexAttributeCount,
     int16_t* vertexAttributes,
-    ReadBitstream& input );
+    ReadBitstream& input,
+    uint32_t flags = 0,
+    uint32_t* attributeScratch = NULL );
+
+// Get the number of chunks in a chunked mesh from CompressMeshChunked, where compressedData points at the start of the chunked mesh.
+uint32_t GetMeshChunkCount( const uint8_t* compressedData );
+
+// Get the number of vertices a chunked mesh decompresses to (the value CompressMeshChunked returned).
+uint32_t GetMeshChunkedVertexCount( const uint8_t* compressedData );
+
+// Decompress a chunked mesh from CompressMeshChunked, with the chunks decompressed in parallel. For meshes with more than
+// MESH_INLINE_ATTRIBUTE_COUNT attributes, each chunk allocates its own attribute scratch.
+// Parameters:
+//     [out] triangles            - Triangle list index buffer (3 indices to vertices per triangle), output from the decompression - 32bit indices
+//     [in]  triangleCount        - The number of triangles to decompress.
+//     [in]  vertexAttributeCount - The number of attributes per vertex
+//     [out] vertexAttributes     - The decompressed vertex attributes, with space for GetMeshChunkedVertexCount vertices.
+//     [in]  compressedData       - The start of the chunked mesh. As with ReadBitstream, there should be some padding past the end.
+//     [in]  compressedSize       - The size of the compressed data in bytes.
+//     [in]  threadCount          - The number of threads to decompress with, including the calling thread (0 for one per hardware thread).
+void DecompressMeshChunked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 16 bit indices.
+void DecompressMeshChunked(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 32 bit indices and 16 bit vertex attributes.
+void DecompressMeshChunked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 16 bit indices and 16 bit vertex attributes.
+void DecompressMeshChunked(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Decompress a single chunk (0 to GetMeshChunkCount - 1) of a chunked mesh, with the same parameters as DecompressMeshChunked.
+// Different chunks of the same mesh can be decompressed at the same time, for use with an existing job system.
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize );
+
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize );
+
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize );
+
+void DecompressMeshChunk(
+    uint32_t chunkIndex,
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize );
+
+// Get the number of vertices in a mesh compressed with the MCF_SEPARATE_STREAMS flag, where compressedData points at the start of it.
+uint32_t GetMeshSeparateVertexCount( const uint8_t* compressedData );
+
+// Decompress a mesh compressed with the MCF_SEPARATE_STREAMS flag. The connectivity is decompressed first (recording how each
+// new vertex is predicted, in a temporary buffer of 16 bytes per vertex), then each attribute column is decompressed from its
+// own stream, in parallel. Returns false, without decompressing anything, if the prefix code lengths at the start of the
+// connectivity are invalid (see DecompressMesh).
+// Parameters:
+//     [out] triangles            - Triangle list index buffer (3 indices to vertices per triangle), output from the decompression - 32bit indices
+//     [in]  triangleCount        - The number of triangles to decompress.
+//     [in]  vertexAttributeCount - The number of attributes per vertex (which must match the compressed mesh).
+//     [out] vertexAttributes     - The decompressed vertex attributes, with space for GetMeshSeparateVertexCount vertices.
+//     [in]  compressedData       - The start of the compressed mesh. As with ReadBitstream, there should be some padding past the end.
+//     [in]  compressedSize       - The size of the compressed data in bytes.
+//     [in]  threadCount          - The number of threads to decompress attribute columns with, including the calling thread
+//                                  (0 for one per hardware thread).
+bool DecompressMeshSeparate(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 16 bit indices.
+bool DecompressMeshSeparate(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 32 bit indices and 16 bit vertex attributes.
+bool DecompressMeshSeparate(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 16 bit indices and 16 bit vertex attributes.
+bool DecompressMeshSeparate(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Decompress a mesh compressed with the MCF_SEPARATE_STREAMS flag, but only the attribute columns set in attributeMask (bit n for
+// column n, so 0x7 for just the positions, if they come first). The streams for other columns are skipped without being read,
+// so decompression time scales with the number of columns wanted (e.g. positions only for collision or navigation meshes).
+// The decompressed columns are packed together in column order, so vertexAttributes needs space for GetMeshSeparateVertexCount
+// vertices of however many columns are in the mask. Only the first 64 columns can be selected. Other parameters (and the result)
+// are the same as DecompressMeshSeparate.
+bool DecompressMeshMasked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 16 bit indices.
+bool DecompressMeshMasked(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 32 bit indices and 16 bit vertex attributes.
+bool DecompressMeshMasked(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Same as above but 16 bit indices and 16 bit vertex attributes.
+bool DecompressMeshMasked(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    uint64_t attributeMask,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t threadCount );
+
+// Decompress only the index buffer of a mesh compressed with the MCF_SEPARATE_STREAMS flag, without reading any of the
+// attribute streams (e.g. for building adjacency or collision structures). Returns false, as DecompressMeshSeparate does, if the
+// code lengths at the start of the connectivity are invalid.
+bool DecompressMeshTopology(
+    uint32_t* triangles,
+    uint32_t triangleCount,
+    const uint8_t* compressedData,
+    size_t compressedSize );
+
+// Same as above but 16 bit indices.
+bool DecompressMeshTopology(
+    uint16_t* triangles,
+    uint32_t triangleCount,
+    const uint8_t* compressedData,
+    size_t compressedSize );
+
+// Build a seek index for a mesh compressed with CompressMesh, recording the bit offset and decompressor state every seekInterval
+// triangles, so ranges of triangles can be decompressed with DecompressMeshRange without decompressing from the start. This
+// decompresses the whole mesh once (into temporary buffers), so it's best done at the same time as compression. Meshes compressed
+// with MCF_LONG_EDGES aren't supported, as long edges can reference triangles from before a checkpoint, and neither are meshes
+// compressed with MCF_FIFO_16, MCF_FIFO_64, MCF_ADAPTIVE_CODES or MCF_TRIANGLE_CONTEXTS.
+// Each checkpoint is ( MESH_SEEK_CURSOR_WORDS + EDGE_FIFO_SIZE * 3 + VERTEX_FIFO_SIZE + vertexAttributeCount ) * 4 bytes, which
+// is ( 134 + vertexAttributeCount ) * 4 bytes, so intervals of a few thousand triangles keep the index to a small fraction of the
+// compressed size.
+// Parameters:
+//     [in]  compressedData       - The start of the compressed mesh (which must have been written at a byte boundary).
+//     [in]  compressedSize       - The size of the compressed data in bytes.
+//     [in]  triangleCount        - The number of triangles in the mesh.
+//     [in]  vertexCount          - The number of vertices in the decompressed mesh.
+//     [in]  vertexAttributeCount - The number of attributes per vertex.
+//     [in]  seekInterval         - The number of triangles between checkpoints (greater than 0).
+//     [in]  seekIndex            - The stream the seek index is written to (kept separate from the compressed mesh).
+void BuildMeshSeekIndex(
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t vertexAttributeCount,
+    uint32_t seekInterval,
+    WriteBitstream& seekIndex );
+
+// Decompress the triangles from firstTriangle up to (not including) lastTriangle, starting from the nearest checkpoint in the seek
+// index, rather than the start of the mesh.
+//
+// Triangles and vertices are written at their position in the whole mesh, so triangles and vertexAttributes should be sized for
+// the whole mesh. The triangles between the checkpoint and firstTriangle are also written, as are the vertices first used from the
+// checkpoint onwards. The triangle indices are always exact, but new vertex attributes are predicted from the vertices they share
+// triangles with, which may come before the checkpoint; use GetMeshRangeDependencies to find out which vertices need to already be
+// in vertexAttributes (e.g. from decompressing an earlier range) for the attributes to be exact. Meshes with more than
+// MESH_INLINE_ATTRIBUTE_COUNT attributes get an attribute scratch allocated for the call.
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint32_t* triangles,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex );
+
+// Same as above but 16 bit indices.
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint16_t* triangles,
+    uint32_t vertexAttributeCount,
+    int32_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex );
+
+// Same as above but 32 bit indices and 16 bit vertex attributes.
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint32_t* triangles,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex );
+
+// Same as above but 16 bit indices and 16 bit vertex attributes.
+void DecompressMeshRange(
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint16_t* triangles,
+    uint32_t vertexAttributeCount,
+    int16_t* vertexAttributes,
+    const uint8_t* compressedData,
+    size_t compressedSize,
+    const uint8_t* seekIndex );
+
+// For decompressing the triangles from firstTriangle up to lastTriangle with DecompressMeshRange, get the first vertex that will
+// be decompressed and the lowest vertex referenced. If lowestVertex is less than firstDecodedVertex, the vertices from lowestVertex
+// up to firstDecodedVertex need to be in vertexAttributes already for the attributes to be exact.
+void GetMeshRangeDependencies(
+    const uint8_t* seekIndex,
+    uint32_t firstTriangle,
+    uint32_t lastTriangle,
+    uint32_t& lowestVertex,
+    uint32_t& firstDecodedVertex );
+
+// Decompresses a mesh a number of triangles at a time, so decompressing a large mesh can be spread out (e.g. over several frames).
+// The result is the same as DecompressMesh; the output buffers and input stream must stay valid until all the triangles are decompressed.
+// On finishing, the input stream is left after the mesh, as with DecompressMesh.
+class MeshDecompressor
+{
+public:
+
+    // Set up decompression, with the same parameters as DecompressMesh. The attribute scratch buffer must stay valid until all the
+    // triangles are decompressed.
+    MeshDecompressor( uint32_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int32_t* vertexAttributes, ReadBitstream& input, uint32_t flags = 0, uint32_t* attributeScratch = NULL );
+
+    // Same as above but 16 bit indices.
+    MeshDecompressor( uint16_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int32_t* vertexAttributes, ReadBitstream& input, uint32_t flags = 0, uint32_t* attributeScratch = NULL );
+
+    // Same as above but 32 bit indices and 16 bit vertex attributes.
+    MeshDecompressor( uint32_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int16_t* vertexAttributes, ReadBitstream& input, uint32_t flags = 0, uint32_t* attributeScratch = NULL );
+
+    // Same as above but 16 bit indices and 16 bit vertex attributes.
+    MeshDecompressor( uint16_t* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, int16_t* vertexAttributes, ReadBitstream& input, uint32_t flags = 0, uint32_t* attributeScratch = NULL );
+
+    ~MeshDecompressor() {}
+
+    // Decompress up to count more triangles (and the vertices they introduce), returning the number decompressed.
+    uint32_t DecodeTriangles( uint32_t count );
+
+    // Has the whole mesh been decompressed?
+    bool IsFinished() const { return m_state.trianglesRead == m_triangleCount; }
+
+    // Were the prefix code lengths at the start of the mesh valid (see DecompressMesh)? If not, no triangles are decompressed.
+    bool IsValid() const { return m_valid; }
+
+    // The number of triangles decompressed so far; these (and their vertices) are ready to use.
+    uint32_t TrianglesDecoded() const { return m_state.trianglesRead; }
+
+    // The number of vertices decompressed so far.
+    uint32_t VerticesDecoded() const { return m_state.newVertices; }
+
+private:
+
+    // Index and attribute types of the output.
+    enum OutputFormat
+    {
+        MDF_UINT32_INT32,
+        MDF_UINT16_INT32,
+        MDF_UINT32_INT16,
+        MDF_UINT16_INT16
+    };
+
+    void Initialise( OutputFormat format, void* triangles, uint32_t triangleCount, uint32_t vertexAttributeCount, void* vertexAttributes, uint32_t flags, uint32_t* attributeScratch );
+
+    // Not copyable
+    MeshDecompressor( const MeshDecompressor& );
+
+    // Not assignable
+    MeshDecompressor& operator=( const MeshDecompressor& );
+
+    MeshDecompressionState m_state;
 
+    // Only built for MCF_ADAPTIVE_CODES or MCF_TRIANGLE_CONTEXTS, and otherwise left untouched.
+    MeshAdaptiveDecoding   m_adaptiveCodes;
+    ReadBitstream&         m_input;
+    void*                  m_triangles;
+    void*                  m_vertexAttributes;
+    uint32_t               m_triangleCount;
+    uint32_t               m_vertexAttributeCount;
+    OutputFormat           m_format;
+    bool                   m_valid;
+};
 
 #endif // -- MESH_DECOMPRESSION_H__
@@ -0,0 +1,607 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "meshgenerator.h"
+#include <assert.h>
+#include <math.h>
+#include <map>
+
+static const float GENERATOR_PI = 3.14159265358979f;
+
+// Number of channels in a generator vertex, which are mapped to quantised attributes.
+static const uint32_t GENERATOR_CHANNEL_COUNT = 8;
+
+// Un-quantised vertex, before it gets turned into attributes.
+struct GeneratorVertex
+{
+    void set( float x, float y, float z, float nx, float ny, float nz, float u, float v )
+    {
+        position[ 0 ] = x;
+        position[ 1 ] = y;
+        position[ 2 ] = z;
+        normal[ 0 ]   = nx;
+        normal[ 1 ]   = ny;
+        normal[ 2 ]   = nz;
+        uv[ 0 ]       = u;
+        uv[ 1 ]       = v;
+    }
+
+    float position[ 3 ];
+    float normal[ 3 ];
+    float uv[ 2 ];
+};
+
+// Small xorshift generator, so results don't depend on the standard library's rand.
+class GeneratorRandom
+{
+public:
+
+    GeneratorRandom( uint32_t seed ) : m_state( seed ^ 0x9E3779B9 )
+    {
+        if ( m_state == 0 )
+        {
+            m_state = 0x9E3779B9;
+        }
+    }
+
+    uint32_t Next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+
+        return m_state;
+    }
+
+    // Uniform in the range 0 to range - 1.
+    uint32_t Next( uint32_t range ) { return static_cast< uint32_t >( ( static_cast< uint64_t >( Next() ) * range ) >> 32 ); }
+
+    // Uniform in the range -1 to 1.
+    float NextSigned() { return ( static_cast< float >( Next() >> 8 ) / static_cast< float >( 1 << 23 ) ) - 1.0f; }
+
+private:
+
+    uint32_t m_state;
+};
+
+// Quantise the generator vertices into the attributes for the mesh, fitting positions to the -1 to 1 range first.
+static void FinishMesh( const char* name, const std::vector< GeneratorVertex >& vertices, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    assert( parameters.attributeBits >= 2 && parameters.attributeBits <= 30 );
+
+    float minimum[ 3 ] = {  1e30f,  1e30f,  1e30f };
+    float maximum[ 3 ] = { -1e30f, -1e30f, -1e30f };
+
+    for ( size_t vertex = 0; vertex < vertices.size(); ++vertex )
+    {
+        for ( uint32_t axis = 0; axis < 3; ++axis )
+        {
+            minimum[ axis ] = fminf( minimum[ axis ], vertices[ vertex ].position[ axis ] );
+            maximum[ axis ] = fmaxf( maximum[ axis ], vertices[ vertex ].position[ axis ] );
+        }
+    }
+
+    float extent = fmaxf( fmaxf( maximum[ 0 ] - minimum[ 0 ], maximum[ 1 ] - minimum[ 1 ] ), fmaxf( maximum[ 2 ] - minimum[ 2 ], 1e-6f ) );
+    float scale  = 2.0f / extent;
+    float range  = static_cast< float >( ( 1 << ( parameters.attributeBits - 1 ) ) - 1 );
+
+    mesh.name                 = name;
+    mesh.triangleCount        = static_cast< uint32_t >( mesh.triangles.size() / 3 );
+    mesh.vertexCount          = static_cast< uint32_t >( vertices.size() );
+    mesh.vertexAttributeCount = parameters.vertexAttributeCount;
+
+    mesh.vertexAttributes.resize( vertices.size() * parameters.vertexAttributeCount );
+
+    int32_t* attribute = mesh.vertexAttributes.empty() ? NULL : &mesh.vertexAttributes[ 0 ];
+
+    for ( size_t vertex = 0; vertex < vertices.size(); ++vertex )
+    {
+        const GeneratorVertex& source = vertices[ vertex ];
+        float                  channels[ GENERATOR_CHANNEL_COUNT ];
+
+        channels[ 0 ] = ( ( source.position[ 0 ] - minimum[ 0 ] ) * scale ) - 1.0f;
+        channels[ 1 ] = ( ( source.position[ 1 ] - minimum[ 1 ] ) * scale ) - 1.0f;
+        channels[ 2 ] = ( ( source.position[ 2 ] - minimum[ 2 ] ) * scale ) - 1.0f;
+        channels[ 3 ] = source.normal[ 0 ];
+        channels[ 4 ] = source.normal[ 1 ];
+        channels[ 5 ] = source.normal[ 2 ];
+        channels[ 6 ] = ( source.uv[ 0 ] * 2.0f ) - 1.0f;
+        channels[ 7 ] = ( source.uv[ 1 ] * 2.0f ) - 1.0f;
+
+        for ( uint32_t attributeIndex = 0; attributeIndex < parameters.vertexAttributeCount; ++attributeIndex, ++attribute )
+        {
+            float channel  = channels[ attributeIndex % GENERATOR_CHANNEL_COUNT ];
+            float harmonic = static_cast< float >( attributeIndex / GENERATOR_CHANNEL_COUNT );
+            float value    = harmonic > 0.0f ? sinf( channel * harmonic * GENERATOR_PI * 0.5f ) : channel;
+
+            value = fminf( fmaxf( value, -1.0f ), 1.0f );
+
+            *attribute = static_cast< int32_t >( floorf( ( value * range ) + 0.5f ) );
+        }
+    }
+}
+
+// Height field shared by the grid style generators, in cell units.
+static void HeightFieldVertex( uint32_t x, uint32_t y, float u, float v, GeneratorVertex& vertex )
+{
+    float fx = static_cast< float >( x );
+    float fy = static_cast< float >( y );
+    float z  = 2.0f * sinf( fx * 0.11f ) * cosf( fy * 0.07f );
+    float dx = 2.0f * 0.11f * cosf( fx * 0.11f ) * cosf( fy * 0.07f );
+    float dy = -2.0f * 0.07f * sinf( fx * 0.11f ) * sinf( fy * 0.07f );
+    float nl = 1.0f / sqrtf( ( dx * dx ) + ( dy * dy ) + 1.0f );
+
+    vertex.set( fx, fy, z, -dx * nl, -dy * nl, nl, u, v );
+}
+
+// Output the two triangles of a grid cell, given the indices of its corners.
+static void GridCell( uint32_t corner, uint32_t right, uint32_t below, uint32_t belowRight, bool reversed, std::vector< uint32_t >& triangles )
+{
+    if ( reversed )
+    {
+        triangles.push_back( right );
+        triangles.push_back( below );
+        triangles.push_back( belowRight );
+    }
+
+    triangles.push_back( corner );
+    triangles.push_back( below );
+    triangles.push_back( right );
+
+    if ( !reversed )
+    {
+        triangles.push_back( right );
+        triangles.push_back( below );
+        triangles.push_back( belowRight );
+    }
+}
+
+static void BuildHeightFieldVertices( uint32_t width, uint32_t height, std::vector< GeneratorVertex >& vertices )
+{
+    vertices.resize( ( width + 1 ) * ( height + 1 ) );
+
+    for ( uint32_t y = 0; y <= height; ++y )
+    {
+        for ( uint32_t x = 0; x <= width; ++x )
+        {
+            HeightFieldVertex( x, y, static_cast< float >( x ) / width, static_cast< float >( y ) / height, vertices[ y * ( width + 1 ) + x ] );
+        }
+    }
+}
+
+void GenerateGrid( uint32_t width, uint32_t height, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    assert( width > 0 && height > 0 );
+
+    std::vector< GeneratorVertex > vertices;
+    uint32_t                       stride = width + 1;
+
+    BuildHeightFieldVertices( width, height, vertices );
+
+    mesh.triangles.clear();
+    mesh.triangles.reserve( width * height * 6 );
+
+    for ( uint32_t y = 0; y < height; ++y )
+    {
+        for ( uint32_t x = 0; x < width; ++x )
+        {
+            uint32_t corner = ( y * stride ) + x;
+
+            GridCell( corner, corner + 1, corner + stride, corner + stride + 1, false, mesh.triangles );
+        }
+    }
+
+    FinishMesh( "grid", vertices, parameters, mesh );
+}
+
+// Recursively subdivide a sphere face, outputting the triangles of the finest level.
+static void SubdivideSphereFace(
+    uint32_t a,
+    uint32_t b,
+    uint32_t c,
+    uint32_t level,
+    std::map< uint64_t, uint32_t >& midpoints,
+    std::vector< GeneratorVertex >& vertices,
+    std::vector< uint32_t >& triangles )
+{
+    if ( level == 0 )
+    {
+        triangles.push_back( a );
+        triangles.push_back( b );
+        triangles.push_back( c );
+        return;
+    }
+
+    uint32_t corners[ 3 ] = { a, b, c };
+    uint32_t middles[ 3 ];
+
+    for ( uint32_t edge = 0; edge < 3; ++edge )
+    {
+        uint32_t first  = corners[ edge ];
+        uint32_t second = corners[ ( edge + 1 ) % 3 ];
+        uint64_t key    = first < second ? ( static_cast< uint64_t >( first ) << 32 ) | second : ( static_cast< uint64_t >( second ) << 32 ) | first;
+
+        std::map< uint64_t, uint32_t >::iterator found = midpoints.find( key );
+
+        if ( found != midpoints.end() )
+        {
+            middles[ edge ] = found->second;
+            continue;
+        }
+
+        const GeneratorVertex& firstVertex  = vertices[ first ];
+        const GeneratorVertex& secondVertex = vertices[ second ];
+        float                  x            = firstVertex.position[ 0 ] + secondVertex.position[ 0 ];
+        float                  y            = firstVertex.position[ 1 ] + secondVertex.position[ 1 ];
+        float                  z            = firstVertex.position[ 2 ] + secondVertex.position[ 2 ];
+        float                  length       = 1.0f / sqrtf( ( x * x ) + ( y * y ) + ( z * z ) );
+        GeneratorVertex        middle;
+
+        x *= length;
+        y *= length;
+        z *= length;
+
+        middle.set( x, y, z, x, y, z, 0.5f + ( atan2f( y, x ) / ( 2.0f * GENERATOR_PI ) ), 0.5f + ( asinf( z ) / GENERATOR_PI ) );
+
+        middles[ edge ]  = static_cast< uint32_t >( vertices.size() );
+        midpoints[ key ] = middles[ edge ];
+
+        vertices.push_back( middle );
+    }
+
+    SubdivideSphereFace( a, middles[ 0 ], middles[ 2 ], level - 1, midpoints, vertices, triangles );
+    SubdivideSphereFace( middles[ 0 ], b, middles[ 1 ], level - 1, midpoints, vertices, triangles );
+    SubdivideSphereFace( middles[ 2 ], middles[ 1 ], c, level - 1, midpoints, vertices, triangles );
+    SubdivideSphereFace( middles[ 0 ], middles[ 1 ], middles[ 2 ], level - 1, midpoints, vertices, triangles );
+}
+
+void GenerateSphere( uint32_t subdivisions, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    static const float    t                      = 1.61803398875f;
+    static const float    icosahedron[ 12 ][ 3 ] =
+    {
+        { -1, t, 0 }, { 1, t, 0 }, { -1, -t, 0 }, { 1, -t, 0 },
+        { 0, -1, t }, { 0, 1, t }, { 0, -1, -t }, { 0, 1, -t },
+        { t, 0, -1 }, { t, 0, 1 }, { -t, 0, -1 }, { -t, 0, 1 }
+    };
+    static const uint32_t faces[ 20 ][ 3 ] =
+    {
+        { 0, 11, 5 }, { 0, 5, 1 }, { 0, 1, 7 }, { 0, 7, 10 }, { 0, 10, 11 },
+        { 1, 5, 9 }, { 5, 11, 4 }, { 11, 10, 2 }, { 10, 7, 6 }, { 7, 1, 8 },
+        { 3, 9, 4 }, { 3, 4, 2 }, { 3, 2, 6 }, { 3, 6, 8 }, { 3, 8, 9 },
+        { 4, 9, 5 }, { 2, 4, 11 }, { 6, 2, 10 }, { 8, 6, 7 }, { 9, 8, 1 }
+    };
+
+    std::vector< GeneratorVertex > vertices( 12 );
+    std::map< uint64_t, uint32_t > midpoints;
+
+    for ( uint32_t vertex = 0; vertex < 12; ++vertex )
+    {
+        const float* corner = icosahedron[ vertex ];
+        float        length = 1.0f / sqrtf( ( corner[ 0 ] * corner[ 0 ] ) + ( corner[ 1 ] * corner[ 1 ] ) + ( corner[ 2 ] * corner[ 2 ] ) );
+        float        x      = corner[ 0 ] * length;
+        float        y      = corner[ 1 ] * length;
+        float        z      = corner[ 2 ] * length;
+
+        vertices[ vertex ].set( x, y, z, x, y, z, 0.5f + ( atan2f( y, x ) / ( 2.0f * GENERATOR_PI ) ), 0.5f + ( asinf( z ) / GENERATOR_PI ) );
+    }
+
+    mesh.triangles.clear();
+    mesh.triangles.reserve( 20 * 3 * ( static_cast< size_t >( 1 ) << ( 2 * subdivisions ) ) );
+
+    for ( uint32_t face = 0; face < 20; ++face )
+    {
+        SubdivideSphereFace( faces[ face ][ 0 ], faces[ face ][ 1 ], faces[ face ][ 2 ], subdivisions, midpoints, vertices, mesh.triangles );
+    }
+
+    FinishMesh( "sphere", vertices, parameters, mesh );
+}
+
+void GenerateTorus( uint32_t rings, uint32_t segments, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    assert( rings >= 3 && segments >= 3 );
+
+    std::vector< GeneratorVertex > vertices( rings * segments );
+
+    for ( uint32_t ring = 0; ring < rings; ++ring )
+    {
+        float theta = ( 2.0f * GENERATOR_PI * ring ) / rings;
+
+        for ( uint32_t segment = 0; segment < segments; ++segment )
+        {
+            float phi    = ( 2.0f * GENERATOR_PI * segment ) / segments;
+            float radius = 1.0f + ( 0.35f * cosf( phi ) );
+
+            vertices[ ( ring * segments ) + segment ].set(
+                radius * cosf( theta ),
+                radius * sinf( theta ),
+                0.35f * sinf( phi ),
+                cosf( phi ) * cosf( theta ),
+                cosf( phi ) * sinf( theta ),
+                sinf( phi ),
+                static_cast< float >( ring ) / rings,
+                static_cast< float >( segment ) / segments );
+        }
+    }
+
+    mesh.triangles.clear();
+    mesh.triangles.reserve( rings * segments * 6 );
+
+    for ( uint32_t ring = 0; ring < rings; ++ring )
+    {
+        uint32_t nextRing = ( ring + 1 ) % rings;
+
+        for ( uint32_t segment = 0; segment < segments; ++segment )
+        {
+            uint32_t nextSegment = ( segment + 1 ) % segments;
+
+            GridCell(
+                ( ring * segments ) + segment,
+                ( ring * segments ) + nextSegment,
+                ( nextRing * segments ) + segment,
+                ( nextRing * segments ) + nextSegment,
+                false,
+                mesh.triangles );
+        }
+    }
+
+    FinishMesh( "torus", vertices, parameters, mesh );
+}
+
+void GenerateTriangleSoup( uint32_t triangleCount, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    GeneratorRandom                random( parameters.seed );
+    std::vector< GeneratorVertex > vertices( triangleCount * 3 );
+
+    mesh.triangles.resize( triangleCount * 3 );
+
+    for ( uint32_t triangle = 0; triangle < triangleCount; ++triangle )
+    {
+        float center[ 3 ] = { random.NextSigned(), random.NextSigned(), random.NextSigned() };
+        float corners[ 3 ][ 3 ];
+
+        for ( uint32_t corner = 0; corner < 3; ++corner )
+        {
+            corners[ corner ][ 0 ] = center[ 0 ] + ( random.NextSigned() * 0.05f );
+            corners[ corner ][ 1 ] = center[ 1 ] + ( random.NextSigned() * 0.05f );
+            corners[ corner ][ 2 ] = center[ 2 ] + ( random.NextSigned() * 0.05f );
+        }
+
+        float edge0[ 3 ] = { corners[ 1 ][ 0 ] - corners[ 0 ][ 0 ], corners[ 1 ][ 1 ] - corners[ 0 ][ 1 ], corners[ 1 ][ 2 ] - corners[ 0 ][ 2 ] };
+        float edge1[ 3 ] = { corners[ 2 ][ 0 ] - corners[ 0 ][ 0 ], corners[ 2 ][ 1 ] - corners[ 0 ][ 1 ], corners[ 2 ][ 2 ] - corners[ 0 ][ 2 ] };
+        float normal[ 3 ] =
+        {
+            ( edge0[ 1 ] * edge1[ 2 ] ) - ( edge0[ 2 ] * edge1[ 1 ] ),
+            ( edge0[ 2 ] * edge1[ 0 ] ) - ( edge0[ 0 ] * edge1[ 2 ] ),
+            ( edge0[ 0 ] * edge1[ 1 ] ) - ( edge0[ 1 ] * edge1[ 0 ] )
+        };
+        float length = sqrtf( ( normal[ 0 ] * normal[ 0 ] ) + ( normal[ 1 ] * normal[ 1 ] ) + ( normal[ 2 ] * normal[ 2 ] ) );
+
+        length = length > 0.0f ? 1.0f / length : 0.0f;
+
+        for ( uint32_t corner = 0; corner < 3; ++corner )
+        {
+            uint32_t vertex = ( triangle * 3 ) + corner;
+
+            vertices[ vertex ].set(
+                corners[ corner ][ 0 ],
+                corners[ corner ][ 1 ],
+                corners[ corner ][ 2 ],
+                normal[ 0 ] * length,
+                normal[ 1 ] * length,
+                normal[ 2 ] * length,
+                ( random.NextSigned() * 0.5f ) + 0.5f,
+                ( random.NextSigned() * 0.5f ) + 0.5f );
+
+            mesh.triangles[ vertex ] = vertex;
+        }
+    }
+
+    FinishMesh( "soup", vertices, parameters, mesh );
+}
+
+void GenerateSeamedGrid( uint32_t width, uint32_t height, uint32_t seamSpacing, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    assert( width > 0 && height > 0 && seamSpacing > 0 );
+
+    uint32_t                       chartsX = ( width + seamSpacing - 1 ) / seamSpacing;
+    uint32_t                       chartsY = ( height + seamSpacing - 1 ) / seamSpacing;
+    std::vector< uint32_t >        chartBase( chartsX * chartsY );
+    std::vector< GeneratorVertex > vertices;
+
+    // Each chart gets its own block of vertices, with uvs local to the chart.
+    for ( uint32_t chartY = 0; chartY < chartsY; ++chartY )
+    {
+        for ( uint32_t chartX = 0; chartX < chartsX; ++chartX )
+        {
+            uint32_t originX     = chartX * seamSpacing;
+            uint32_t originY     = chartY * seamSpacing;
+            uint32_t chartWidth  = width - originX < seamSpacing ? width - originX : seamSpacing;
+            uint32_t chartHeight = height - originY < seamSpacing ? height - originY : seamSpacing;
+
+            chartBase[ ( chartY * chartsX ) + chartX ] = static_cast< uint32_t >( vertices.size() );
+
+            for ( uint32_t y = 0; y <= chartHeight; ++y )
+            {
+                for ( uint32_t x = 0; x <= chartWidth; ++x )
+                {
+                    GeneratorVertex vertex;
+
+                    HeightFieldVertex( originX + x, originY + y, static_cast< float >( x ) / seamSpacing, static_cast< float >( y ) / seamSpacing, vertex );
+
+                    vertices.push_back( vertex );
+                }
+            }
+        }
+    }
+
+    mesh.triangles.clear();
+    mesh.triangles.reserve( width * height * 6 );
+
+    for ( uint32_t y = 0; y < height; ++y )
+    {
+        for ( uint32_t x = 0; x < width; ++x )
+        {
+            uint32_t chartX     = x / seamSpacing;
+            uint32_t chartY     = y / seamSpacing;
+            uint32_t chartWidth = width - ( chartX * seamSpacing ) < seamSpacing ? width - ( chartX * seamSpacing ) : seamSpacing;
+            uint32_t stride     = chartWidth + 1;
+            uint32_t corner     = chartBase[ ( chartY * chartsX ) + chartX ] + ( ( y - ( chartY * seamSpacing ) ) * stride ) + ( x - ( chartX * seamSpacing ) );
+
+            GridCell( corner, corner + 1, corner + stride, corner + stride + 1, false, mesh.triangles );
+        }
+    }
+
+    FinishMesh( "seams", vertices, parameters, mesh );
+}
+
+void GenerateStrips( uint32_t stripCount, uint32_t stripLength, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    assert( stripCount > 0 && stripLength > 0 );
+
+    std::vector< GeneratorVertex > vertices;
+    uint32_t                       stride = stripLength + 1;
+
+    BuildHeightFieldVertices( stripLength, stripCount, vertices );
+
+    mesh.triangles.clear();
+    mesh.triangles.reserve( stripCount * stripLength * 6 );
+
+    // Alternate strips run in opposite directions, so each strip starts next to where the last one finished.
+    for ( uint32_t strip = 0; strip < stripCount; ++strip )
+    {
+        bool reversed = ( strip & 1 ) != 0;
+
+        for ( uint32_t quad = 0; quad < stripLength; ++quad )
+        {
+            uint32_t x      = reversed ? stripLength - 1 - quad : quad;
+            uint32_t corner = ( strip * stride ) + x;
+
+            GridCell( corner, corner + 1, corner + stride, corner + stride + 1, reversed, mesh.triangles );
+        }
+    }
+
+    FinishMesh( "strips", vertices, parameters, mesh );
+}
+
+void GenerateFan( uint32_t triangleCount, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh )
+{
+    assert( triangleCount >= 3 );
+
+    std::vector< GeneratorVertex > vertices( triangleCount + 1 );
+
+    vertices[ 0 ].set( 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.5f, 0.5f );
+
+    for ( uint32_t rim = 0; rim < triangleCount; ++rim )
+    {
+        float theta = ( 2.0f * GENERATOR_PI * rim ) / triangleCount;
+
+        vertices[ rim + 1 ].set( cosf( theta ), sinf( theta ), 0.0f, 0.0f, 0.0f, 1.0f, 0.5f + ( 0.5f * cosf( theta ) ), 0.5f + ( 0.5f * sinf( theta ) ) );
+    }
+
+    mesh.triangles.resize( static_cast< size_t >( triangleCount ) * 3 );
+
+    for ( uint32_t triangle = 0; triangle < triangleCount; ++triangle )
+    {
+        mesh.triangles[ ( triangle * 3 ) ]     = 0;
+        mesh.triangles[ ( triangle * 3 ) + 1 ] = triangle + 1;
+        mesh.triangles[ ( triangle * 3 ) + 2 ] = ( ( triangle + 1 ) % triangleCount ) + 1;
+    }
+
+    FinishMesh( "fan", vertices, parameters, mesh );
+}
+
+void ShuffleTriangles( float shuffleFraction, uint32_t seed, GeneratedMesh& mesh )
+{
+    if ( mesh.triangleCount < 2 )
+    {
+        return;
+    }
+
+    GeneratorRandom random( seed );
+    uint32_t        swapCount = static_cast< uint32_t >( shuffleFraction * mesh.triangleCount );
+    uint32_t*       triangles = &mesh.triangles[ 0 ];
+
+    for ( uint32_t swap = 0; swap < swapCount; ++swap )
+    {
+        uint32_t* first          = triangles + ( random.Next( mesh.triangleCount ) * 3 );
+        uint32_t* second         = triangles + ( random.Next( mesh.triangleCount ) * 3 );
+        uint32_t  firstRotation  = random.Next( 3 );
+        uint32_t  secondRotation = random.Next( 3 );
+        uint32_t  swapped[ 3 ]   = { first[ 0 ], first[ 1 ], first[ 2 ] };
+
+        if ( first == second )
+        {
+            continue;
+        }
+
+        first[ 0 ] = second[ secondRotation ];
+        first[ 1 ] = second[ ( secondRotation + 1 ) % 3 ];
+        first[ 2 ] = second[ ( secondRotation + 2 ) % 3 ];
+
+        second[ 0 ] = swapped[ firstRotation ];
+        second[ 1 ] = swapped[ ( firstRotation + 1 ) % 3 ];
+        second[ 2 ] = swapped[ ( firstRotation + 2 ) % 3 ];
+    }
+}
+
+void GenerateMeshCorpus( uint32_t targetTriangleCount, const MeshGeneratorParameters& parameters, std::vector< GeneratedMesh >& corpus )
+{
+    uint32_t gridSide     = static_cast< uint32_t >( sqrtf( targetTriangleCount * 0.5f ) ) + 1;
+    uint32_t subdivisions = 0;
+    uint32_t torusSide    = static_cast< uint32_t >( sqrtf( targetTriangleCount * 0.25f ) ) + 3;
+    uint32_t stripLength  = 512;
+    uint32_t stripCount   = ( targetTriangleCount / ( stripLength * 2 ) ) + 1;
+
+    while ( 20 * ( static_cast< uint64_t >( 1 ) << ( 2 * ( subdivisions + 1 ) ) ) <= targetTriangleCount )
+    {
+        ++subdivisions;
+    }
+
+    corpus.clear();
+    corpus.resize( 10 );
+
+    GenerateGrid( gridSide, gridSide, parameters, corpus[ 0 ] );
+    GenerateSphere( subdivisions, parameters, corpus[ 1 ] );
+    GenerateTorus( torusSide * 2, torusSide, parameters, corpus[ 2 ] );
+    GenerateTriangleSoup( targetTriangleCount, parameters, corpus[ 3 ] );
+    GenerateSeamedGrid( gridSide, gridSide, 8, parameters, corpus[ 4 ] );
+    GenerateStrips( stripCount, stripLength, parameters, corpus[ 5 ] );
+
+    GenerateGrid( gridSide, gridSide, parameters, corpus[ 6 ] );
+    ShuffleTriangles( 1.0f, parameters.seed, corpus[ 6 ] );
+    corpus[ 6 ].name = "shuffled grid";
+
+    GenerateSphere( subdivisions, parameters, corpus[ 7 ] );
+    ShuffleTriangles( 0.05f, parameters.seed + 1, corpus[ 7 ] );
+    corpus[ 7 ].name = "5% shuffled sphere";
+
+    GenerateStrips( stripCount, stripLength, parameters, corpus[ 8 ] );
+    ShuffleTriangles( 0.05f, parameters.seed + 2, corpus[ 8 ] );
+    corpus[ 8 ].name = "5% shuffled strips";
+
+    GenerateFan( targetTriangleCount > 3 ? targetTriangleCount : 3, parameters, corpus[ 9 ] );
+    ShuffleTriangles( 1.0f, parameters.seed + 3, corpus[ 9 ] );
+    corpus[ 9 ].name = "shuffled fan";
+}
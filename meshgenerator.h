@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef MESH_GENERATOR_H__
+#define MESH_GENERATOR_H__
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// Synthetic meshes for reproducible compression and throughput measurements.
+//
+// All generators are deterministic for a given set of parameters (including the seed), so results can be compared between
+// runs and machines. Vertex attributes are quantised from a position (3), normal (3) and uv (2) per vertex, in that order,
+// with any further attributes being smooth functions of those, so the parallelogram and delta predictors behave much as
+// they would for real content.
+
+// Parameters shared by all of the generators.
+struct MeshGeneratorParameters
+{
+    // The number of attributes generated for each vertex.
+    uint32_t vertexAttributeCount;
+
+    // Attributes are quantised to the range -2^(attributeBits - 1) to 2^(attributeBits - 1) - 1.
+    // Use 15 or less for meshes that will be compressed with 16 bit attributes, and 30 or less otherwise.
+    uint32_t attributeBits;
+
+    // Seed for the pseudo random parts of generation (soups and shuffling).
+    uint32_t seed;
+};
+
+// A generated triangle list mesh, with 32 bit indices and quantised 32 bit attributes.
+struct GeneratedMesh
+{
+    const char*             name;
+    std::vector< uint32_t > triangles;
+    std::vector< int32_t >  vertexAttributes;
+    uint32_t                triangleCount;
+    uint32_t                vertexCount;
+    uint32_t                vertexAttributeCount;
+};
+
+// A (width x height) cell grid over a gently curved height field, in row order.
+// Rows shorter than the FIFO sizes compress almost entirely with IB_EDGE_NEW and IB_EDGE_CACHED.
+void GenerateGrid( uint32_t width, uint32_t height, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh );
+
+// A sphere from an icosahedron subdivided "subdivisions" times (20 * 4^subdivisions triangles), with the children of each face
+// output together. Closed and well connected, with a mix of edge codes and cached vertices.
+void GenerateSphere( uint32_t subdivisions, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh );
+
+// A closed torus of (rings x segments) cells, in ring order. Closing each ring and the final ring references vertices that are
+// long gone from the FIFOs, which exercises the free vertex codes.
+void GenerateTorus( uint32_t rings, uint32_t segments, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh );
+
+// Randomly placed triangles that share no vertices, so every triangle is encoded as IB_NEW_NEW_NEW.
+void GenerateTriangleSoup( uint32_t triangleCount, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh );
+
+// A (width x height) cell grid split into square charts of seamSpacing cells, where vertices along chart borders are duplicated
+// with differing uvs (like texture seams). Triangles crossing into a new chart can't use the edge FIFO and start with new vertices.
+void GenerateSeamedGrid( uint32_t width, uint32_t height, uint32_t seamSpacing, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh );
+
+// stripCount adjacent strips, each stripLength quads long, output a strip at a time with alternate strips running in opposite
+// directions. When stripLength is well above the FIFO sizes, the edges shared with the previous strip have mostly left the FIFOs,
+// so most quads start with a free vertex.
+void GenerateStrips( uint32_t stripCount, uint32_t stripLength, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh );
+
+// A closed disc of triangleCount triangles (at least 3) fanned around a single hub vertex, which has a triangle for each of them
+// (like a pole or a CAD hub). Meshes with vertices this well connected are the worst case for searching around FIFO vertices.
+void GenerateFan( uint32_t triangleCount, const MeshGeneratorParameters& parameters, GeneratedMesh& mesh );
+
+// Poorly order a mesh by randomly swapping (shuffleFraction * triangleCount) pairs of triangles and rotating the vertices of the
+// swapped triangles. A shuffleFraction of 1 or more gives an effectively random order.
+void ShuffleTriangles( float shuffleFraction, uint32_t seed, GeneratedMesh& mesh );
+
+// Generate the standard corpus, with one mesh of each kind (plus shuffled variants) sized to roughly targetTriangleCount triangles.
+void GenerateMeshCorpus( uint32_t targetTriangleCount, const MeshGeneratorParameters& parameters, std::vector< GeneratedMesh >& corpus );
+
+#endif // -- MESH_GENERATOR_H__
@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef MESH_PARALLEL_H__
+#define MESH_PARALLEL_H__
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+
+// Run job( jobIndex ) for every jobIndex in 0..jobCount - 1 across up to threadCount threads (including the calling thread),
+// returning when all the jobs are done. A threadCount of 0 uses one thread per hardware thread. Jobs are handed out in order,
+// one at a time, so uneven jobs balance out. Internal to the chunked and separate stream compression/decompression.
+template < typename JobType >
+void RunParallel( uint32_t jobCount, uint32_t threadCount, JobType& job )
+{
+    if ( threadCount == 0 )
+    {
+        threadCount = std::thread::hardware_concurrency();
+    }
+
+    if ( threadCount > jobCount )
+    {
+        threadCount = jobCount;
+    }
+
+    if ( threadCount <= 1 )
+    {
+        for ( uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex )
+        {
+            job( jobIndex );
+        }
+
+        return;
+    }
+
+    std::atomic< uint32_t > nextJob( 0 );
+
+    auto worker = [ & ]()
+    {
+        for ( uint32_t jobIndex = nextJob++; jobIndex < jobCount; jobIndex = nextJob++ )
+        {
+            job( jobIndex );
+        }
+    };
+
+    std::thread* threads = new std::thread[ threadCount - 1 ];
+
+    for ( uint32_t thread = 0; thread < threadCount - 1; ++thread )
+    {
+        threads[ thread ] = std::thread( worker );
+    }
+
+    worker();
+
+    for ( uint32_t thread = 0; thread < threadCount - 1; ++thread )
+    {
+        threads[ thread ].join();
+    }
+
+    delete[] threads;
+}
+
+#endif // -- MESH_PARALLEL_H__
@@ -0,0 +1,528 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "meshreorder.h"
+#include "indexcompressionconstants.h"
+#include <assert.h>
+#include <string.h>
+
+// Value for vertices that haven't been put in the vertex FIFO yet.
+static const uint32_t VERTEX_NOT_SEEN = 0xFFFFFFFF;
+
+// Value for no triangle found.
+static const uint32_t NO_TRIANGLE = 0xFFFFFFFF;
+
+// Approximate costs in bits used for scoring candidate triangles. These roughly follow the lengths in the fixed prefix code
+// tables, with new vertices in non-edge cases costing extra because they lose the parallelogram predictor, and free vertices
+// costing a WriteVInt of their relative index.
+static const int32_t NEW_VERTEX_EDGE_COST      = 1;
+static const int32_t NEW_VERTEX_COST           = 6;
+static const int32_t FREE_VERTEX_CODE_COST     = 4;
+static const int32_t VERTEX_TRIANGLE_CODE_COST = 5;
+static const int32_t FINISHED_VERTEX_BONUS     = 1;
+static const int32_t EVICTED_VERTEX_COST       = 12;
+
+// The most live triangles looked at around any one vertex when searching for the next triangle. Ordinary meshes have far fewer
+// around each vertex, but this stops high valence vertices (poles, fans, CAD hubs) from making each step cost their valence.
+static const uint32_t ADJACENCY_SEARCH_LIMIT   = 32;
+
+// Working state for reordering, emulating the compressor's FIFOs.
+struct ReorderState
+{
+    uint32_t  edgeFirst[ EDGE_FIFO_SIZE ];
+    uint32_t  edgeSecond[ EDGE_FIFO_SIZE ];
+    uint32_t  vertexFifo[ VERTEX_FIFO_SIZE ];
+    uint32_t  edgesRead;
+    uint32_t  verticesRead;
+    uint32_t  newVertices;
+
+    // Per vertex, the order the vertex was first output in (the compressor's vertex remap), or VERTEX_NOT_SEEN.
+    uint32_t* vertexRemap;
+
+    // Per vertex, the vertex FIFO cursor when the vertex was last put in the FIFO (or VERTEX_NOT_SEEN).
+    uint32_t* lastSeen;
+
+    // Per vertex, the triangles that haven't been output yet are kept at the start of each vertex's adjacency list.
+    uint32_t* adjacencyOffsets;
+    uint32_t* adjacency;
+    uint32_t* liveCounts;
+
+    // Per triangle corner, where the triangle is in the corner vertex's adjacency list, so it can be removed without a search.
+    uint32_t* adjacencyPositions;
+
+    // Per triangle, non-zero once it has been output.
+    uint8_t*  triangleOutput;
+
+    // Stack of recently used vertices, for restarting when there are no connected triangles left.
+    uint32_t* deadEndStack;
+    uint32_t  deadEndStackSize;
+};
+
+static inline uint32_t EdgeCost( uint32_t relativeEdge )
+{
+    return 2 + ( ( relativeEdge * 9 ) >> 5 );
+}
+
+static inline uint32_t CachedVertexCost( uint32_t cachedVertexIndex )
+{
+    return 2 + ( cachedVertexIndex >> 2 );
+}
+
+// Cost of a vertex in a triangle (not counting the triangle code), classifying it like the compressor would.
+static inline uint32_t FreeVertexCost( uint32_t relativeVertex )
+{
+    uint32_t cost = FREE_VERTEX_CODE_COST + 8;
+
+    for ( relativeVertex >>= 7; relativeVertex > 0; relativeVertex >>= 7 )
+    {
+        cost += 8;
+    }
+
+    return cost;
+}
+
+static inline int32_t VertexCost( const ReorderState& state, uint32_t vertex, int32_t newVertexCost )
+{
+    uint32_t lastSeen = state.lastSeen[ vertex ];
+
+    if ( lastSeen == VERTEX_NOT_SEEN )
+    {
+        return newVertexCost;
+    }
+    else if ( state.verticesRead - lastSeen <= VERTEX_FIFO_SIZE )
+    {
+        return static_cast< int32_t >( CachedVertexCost( ( state.verticesRead - 1 ) - lastSeen ) );
+    }
+
+    return static_cast< int32_t >( FreeVertexCost( ( state.newVertices - 1 ) - state.vertexRemap[ vertex ] ) );
+}
+
+// Bonus for triangles that finish off vertices, so we don't leave stragglers that need free vertex references later.
+static inline int32_t FinishedVertexBonus( const ReorderState& state, const uint32_t* triangle )
+{
+    return FINISHED_VERTEX_BONUS * ( ( state.liveCounts[ triangle[ 0 ] ] == 1 ) +
+                                     ( state.liveCounts[ triangle[ 1 ] ] == 1 ) +
+                                     ( state.liveCounts[ triangle[ 2 ] ] == 1 ) );
+}
+
+// Cost of pushing pushCount vertices into the vertex FIFO, where any evicted vertex that still has triangles left will need
+// a free vertex reference later. This is what stops the walk from spiralling out in long strips, turning back to pick up
+// triangles around older vertices before they leave the FIFO.
+static inline int32_t EvictionCost( const ReorderState& state, uint32_t pushCount )
+{
+    int32_t cost = 0;
+
+    for ( uint32_t push = 0; push < pushCount; ++push )
+    {
+        uint32_t evictedCursor = state.verticesRead + push - VERTEX_FIFO_SIZE;
+
+        if ( state.verticesRead + push < VERTEX_FIFO_SIZE )
+        {
+            continue;
+        }
+
+        uint32_t evicted = state.vertexFifo[ evictedCursor & VERTEX_FIFO_MASK ];
+
+        if ( state.lastSeen[ evicted ] == evictedCursor && state.liveCounts[ evicted ] > 1 )
+        {
+            cost += EVICTED_VERTEX_COST;
+        }
+    }
+
+    return cost;
+}
+
+// Eviction costs for pushing 0 to 3 vertices, which are the same for every candidate triangle in a search.
+static inline void EvictionCosts( const ReorderState& state, int32_t* costs )
+{
+    for ( uint32_t pushCount = 0; pushCount <= 3; ++pushCount )
+    {
+        costs[ pushCount ] = EvictionCost( state, pushCount );
+    }
+}
+
+static inline bool IsCached( const ReorderState& state, uint32_t vertex )
+{
+    uint32_t lastSeen = state.lastSeen[ vertex ];
+
+    return lastSeen != VERTEX_NOT_SEEN && state.verticesRead - lastSeen <= VERTEX_FIFO_SIZE;
+}
+
+static inline void PushVertex( ReorderState& state, uint32_t vertex )
+{
+    if ( state.vertexRemap[ vertex ] == VERTEX_NOT_SEEN )
+    {
+        state.vertexRemap[ vertex ] = state.newVertices++;
+    }
+
+    state.vertexFifo[ state.verticesRead & VERTEX_FIFO_MASK ] = vertex;
+    state.lastSeen[ vertex ]                                  = state.verticesRead;
+
+    ++state.verticesRead;
+}
+
+static inline void PushEdge( ReorderState& state, uint32_t first, uint32_t second )
+{
+    state.edgeFirst[ state.edgesRead & EDGE_FIFO_MASK ]  = first;
+    state.edgeSecond[ state.edgesRead & EDGE_FIFO_MASK ] = second;
+
+    ++state.edgesRead;
+}
+
+// Update the emulated FIFOs for outputting a triangle, the same way the compressor does. The only difference is the
+// order edges/vertices are pushed for the non-edge cases, where the compressor rotates the triangle depending on the
+// vertex classification, which doesn't change much for scoring.
+static void OutputTriangle( ReorderState& state, const uint32_t* triangles, uint32_t triangleIndex )
+{
+    const uint32_t* triangle = triangles + ( triangleIndex * 3 );
+
+    int32_t lowestEdgeCursor = state.edgesRead >= EDGE_FIFO_SIZE ? state.edgesRead - EDGE_FIFO_SIZE : 0;
+    int32_t spareVertex      = -1;
+
+    for ( int32_t edgeCursor = state.edgesRead - 1; edgeCursor >= lowestEdgeCursor; --edgeCursor )
+    {
+        uint32_t first  = state.edgeFirst[ edgeCursor & EDGE_FIFO_MASK ];
+        uint32_t second = state.edgeSecond[ edgeCursor & EDGE_FIFO_MASK ];
+
+        if ( second == triangle[ 0 ] && first == triangle[ 1 ] )
+        {
+            spareVertex = 2;
+            break;
+        }
+        else if ( second == triangle[ 1 ] && first == triangle[ 2 ] )
+        {
+            spareVertex = 0;
+            break;
+        }
+        else if ( second == triangle[ 2 ] && first == triangle[ 0 ] )
+        {
+            spareVertex = 1;
+            break;
+        }
+    }
+
+    if ( spareVertex >= 0 )
+    {
+        uint32_t spare = triangle[ spareVertex ];
+        uint32_t next  = triangle[ ( spareVertex + 1 ) % 3 ];
+        uint32_t last  = triangle[ ( spareVertex + 2 ) % 3 ];
+
+        if ( !IsCached( state, spare ) )
+        {
+            PushVertex( state, spare );
+        }
+
+        PushEdge( state, last, spare );
+        PushEdge( state, spare, next );
+    }
+    else
+    {
+        bool isCached[ 3 ] = { IsCached( state, triangle[ 0 ] ), IsCached( state, triangle[ 1 ] ), IsCached( state, triangle[ 2 ] ) };
+
+        for ( uint32_t vertex = 0; vertex < 3; ++vertex )
+        {
+            if ( !isCached[ vertex ] )
+            {
+                PushVertex( state, triangle[ vertex ] );
+            }
+        }
+
+        PushEdge( state, triangle[ 0 ], triangle[ 1 ] );
+        PushEdge( state, triangle[ 1 ], triangle[ 2 ] );
+        PushEdge( state, triangle[ 2 ], triangle[ 0 ] );
+    }
+
+    // Remove the triangle from the live part of each vertex's adjacency list, swapping it with the last live triangle.
+    for ( uint32_t vertex = 0; vertex < 3; ++vertex )
+    {
+        uint32_t        vertexIndex = triangle[ vertex ];
+        uint32_t*       adjacent    = state.adjacency + state.adjacencyOffsets[ vertexIndex ];
+        uint32_t        lastLive    = --state.liveCounts[ vertexIndex ];
+        uint32_t        where       = state.adjacencyPositions[ ( triangleIndex * 3 ) + vertex ];
+        uint32_t        moved       = adjacent[ lastLive ];
+        const uint32_t* movedCorner = triangles + ( moved * 3 );
+
+        adjacent[ where ]    = moved;
+        adjacent[ lastLive ] = triangleIndex;
+
+        state.adjacencyPositions[ ( moved * 3 ) + ( movedCorner[ 0 ] == vertexIndex ? 0 : ( movedCorner[ 1 ] == vertexIndex ? 1 : 2 ) ) ] = where;
+        state.adjacencyPositions[ ( triangleIndex * 3 ) + vertex ]                                                                        = lastLive;
+
+        if ( lastLive > 0 )
+        {
+            state.deadEndStack[ state.deadEndStackSize++ ] = vertexIndex;
+        }
+    }
+
+    state.triangleOutput[ triangleIndex ] = 1;
+}
+
+// Find the cheapest triangle sharing an edge in the edge FIFO.
+static uint32_t FindEdgeTriangle( const ReorderState& state, const uint32_t* triangles )
+{
+    int32_t  lowestEdgeCursor = state.edgesRead >= EDGE_FIFO_SIZE ? state.edgesRead - EDGE_FIFO_SIZE : 0;
+    uint32_t bestTriangle     = NO_TRIANGLE;
+    int32_t  bestCost         = 0x7FFFFFFF;
+    int32_t  evictionCosts[ 4 ];
+
+    EvictionCosts( state, evictionCosts );
+
+    for ( int32_t edgeCursor = state.edgesRead - 1; edgeCursor >= lowestEdgeCursor; --edgeCursor )
+    {
+        uint32_t first  = state.edgeFirst[ edgeCursor & EDGE_FIFO_MASK ];
+        uint32_t second = state.edgeSecond[ edgeCursor & EDGE_FIFO_MASK ];
+
+        // The matching triangle is around both vertices of the edge, so search whichever has fewer triangles left.
+        uint32_t        searched    = state.liveCounts[ first ] < state.liveCounts[ second ] ? first : second;
+        uint32_t        searchCount = state.liveCounts[ searched ] < ADJACENCY_SEARCH_LIMIT ? state.liveCounts[ searched ] : ADJACENCY_SEARCH_LIMIT;
+        const uint32_t* adjacent    = state.adjacency + state.adjacencyOffsets[ searched ];
+        const uint32_t* adjacentEnd = adjacent + searchCount;
+        int32_t         edgeCost    = static_cast< int32_t >( EdgeCost( ( state.edgesRead - 1 ) - edgeCursor ) );
+
+        // The matching triangle has the edge in the opposite direction.
+        for ( ; adjacent < adjacentEnd; ++adjacent )
+        {
+            const uint32_t* triangle = triangles + ( *adjacent * 3 );
+            uint32_t        third;
+
+            if ( triangle[ 0 ] == second && triangle[ 1 ] == first )
+            {
+                third = triangle[ 2 ];
+            }
+            else if ( triangle[ 1 ] == second && triangle[ 2 ] == first )
+            {
+                third = triangle[ 0 ];
+            }
+            else if ( triangle[ 2 ] == second && triangle[ 0 ] == first )
+            {
+                third = triangle[ 1 ];
+            }
+            else
+            {
+                continue;
+            }
+
+            int32_t cost = edgeCost + VertexCost( state, third, NEW_VERTEX_EDGE_COST ) - FinishedVertexBonus( state, triangle ) +
+                           evictionCosts[ IsCached( state, third ) ? 0 : 1 ];
+
+            if ( cost < bestCost )
+            {
+                bestCost     = cost;
+                bestTriangle = *adjacent;
+            }
+        }
+    }
+
+    return bestTriangle;
+}
+
+// Find the cheapest triangle using a vertex in the vertex FIFO.
+static uint32_t FindVertexTriangle( const ReorderState& state, const uint32_t* triangles )
+{
+    int32_t  lowestVertexCursor = state.verticesRead >= VERTEX_FIFO_SIZE ? state.verticesRead - VERTEX_FIFO_SIZE : 0;
+    uint32_t bestTriangle       = NO_TRIANGLE;
+    int32_t  bestCost           = 0x7FFFFFFF;
+    int32_t  evictionCosts[ 4 ];
+
+    EvictionCosts( state, evictionCosts );
+
+    for ( int32_t vertexCursor = state.verticesRead - 1; vertexCursor >= lowestVertexCursor; --vertexCursor )
+    {
+        uint32_t vertex = state.vertexFifo[ vertexCursor & VERTEX_FIFO_MASK ];
+
+        // Skip older copies of vertices that have been put in the FIFO again since.
+        if ( state.lastSeen[ vertex ] != static_cast< uint32_t >( vertexCursor ) )
+        {
+            continue;
+        }
+
+        uint32_t        searchCount = state.liveCounts[ vertex ] < ADJACENCY_SEARCH_LIMIT ? state.liveCounts[ vertex ] : ADJACENCY_SEARCH_LIMIT;
+        const uint32_t* adjacent    = state.adjacency + state.adjacencyOffsets[ vertex ];
+        const uint32_t* adjacentEnd = adjacent + searchCount;
+
+        for ( ; adjacent < adjacentEnd; ++adjacent )
+        {
+            const uint32_t* triangle = triangles + ( *adjacent * 3 );
+            int32_t         cost     = VERTEX_TRIANGLE_CODE_COST +
+                                       VertexCost( state, triangle[ 0 ], NEW_VERTEX_COST ) +
+                                       VertexCost( state, triangle[ 1 ], NEW_VERTEX_COST ) +
+                                       VertexCost( state, triangle[ 2 ], NEW_VERTEX_COST ) -
+                                       FinishedVertexBonus( state, triangle ) +
+                                       evictionCosts[ !IsCached( state, triangle[ 0 ] ) +
+                                                      !IsCached( state, triangle[ 1 ] ) +
+                                                      !IsCached( state, triangle[ 2 ] ) ];
+
+            if ( cost < bestCost )
+            {
+                bestCost     = cost;
+                bestTriangle = *adjacent;
+            }
+        }
+    }
+
+    return bestTriangle;
+}
+
+template < typename IndiceType >
+static void ReorderTriangles(
+    const IndiceType* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    IndiceType* reorderedTriangles,
+    uint32_t* trianglePermutation )
+{
+    assert( static_cast< const void* >( triangles ) != static_cast< const void* >( reorderedTriangles ) );
+
+    uint32_t     indiceCount   = triangleCount * 3;
+    uint32_t*    wideTriangles = new uint32_t[ indiceCount ];
+    ReorderState state;
+
+    state.edgesRead          = 0;
+    state.verticesRead       = 0;
+    state.newVertices        = 0;
+    state.vertexRemap        = new uint32_t[ vertexCount ];
+    state.lastSeen           = new uint32_t[ vertexCount ];
+    state.adjacencyOffsets   = new uint32_t[ vertexCount + 1 ];
+    state.adjacency          = new uint32_t[ indiceCount ];
+    state.liveCounts         = new uint32_t[ vertexCount ];
+    state.adjacencyPositions = new uint32_t[ indiceCount ];
+    state.triangleOutput     = new uint8_t[ triangleCount ];
+    state.deadEndStack       = new uint32_t[ indiceCount ];
+    state.deadEndStackSize   = 0;
+
+    ::memset( state.vertexRemap, 0xFF, vertexCount * sizeof( uint32_t ) );
+    ::memset( state.lastSeen, 0xFF, vertexCount * sizeof( uint32_t ) );
+    ::memset( state.liveCounts, 0, vertexCount * sizeof( uint32_t ) );
+    ::memset( state.triangleOutput, 0, triangleCount );
+
+    // Build the vertex to triangle adjacency.
+    for ( uint32_t indice = 0; indice < indiceCount; ++indice )
+    {
+        wideTriangles[ indice ] = triangles[ indice ];
+
+        assert( triangles[ indice ] < vertexCount );
+
+        ++state.liveCounts[ triangles[ indice ] ];
+    }
+
+    uint32_t offset = 0;
+
+    for ( uint32_t vertex = 0; vertex < vertexCount; ++vertex )
+    {
+        state.adjacencyOffsets[ vertex ] = offset;
+
+        offset += state.liveCounts[ vertex ];
+
+        state.liveCounts[ vertex ] = 0;
+    }
+
+    state.adjacencyOffsets[ vertexCount ] = offset;
+
+    for ( uint32_t triangle = 0; triangle < triangleCount; ++triangle )
+    {
+        for ( uint32_t vertex = 0; vertex < 3; ++vertex )
+        {
+            uint32_t vertexIndex = wideTriangles[ ( triangle * 3 ) + vertex ];
+
+            state.adjacencyPositions[ ( triangle * 3 ) + vertex ]                                       = state.liveCounts[ vertexIndex ];
+            state.adjacency[ state.adjacencyOffsets[ vertexIndex ] + state.liveCounts[ vertexIndex ]++ ] = triangle;
+        }
+    }
+
+    uint32_t inputCursor = 0;
+
+    for ( uint32_t output = 0; output < triangleCount; ++output )
+    {
+        uint32_t next = FindEdgeTriangle( state, wideTriangles );
+
+        if ( next == NO_TRIANGLE )
+        {
+            next = FindVertexTriangle( state, wideTriangles );
+        }
+
+        // Dead end, so restart from the most recently used vertex with triangles left, or failing that, the input order.
+        while ( next == NO_TRIANGLE && state.deadEndStackSize > 0 )
+        {
+            uint32_t vertex = state.deadEndStack[ --state.deadEndStackSize ];
+
+            if ( state.liveCounts[ vertex ] > 0 )
+            {
+                next = state.adjacency[ state.adjacencyOffsets[ vertex ] ];
+            }
+        }
+
+        if ( next == NO_TRIANGLE )
+        {
+            while ( state.triangleOutput[ inputCursor ] != 0 )
+            {
+                ++inputCursor;
+            }
+
+            next = inputCursor;
+        }
+
+        const uint32_t* triangle = wideTriangles + ( next * 3 );
+
+        OutputTriangle( state, wideTriangles, next );
+
+        reorderedTriangles[ ( output * 3 ) ]     = static_cast< IndiceType >( triangle[ 0 ] );
+        reorderedTriangles[ ( output * 3 ) + 1 ] = static_cast< IndiceType >( triangle[ 1 ] );
+        reorderedTriangles[ ( output * 3 ) + 2 ] = static_cast< IndiceType >( triangle[ 2 ] );
+
+        if ( trianglePermutation != NULL )
+        {
+            trianglePermutation[ output ] = next;
+        }
+    }
+
+    delete[] state.deadEndStack;
+    delete[] state.triangleOutput;
+    delete[] state.adjacencyPositions;
+    delete[] state.liveCounts;
+    delete[] state.adjacency;
+    delete[] state.adjacencyOffsets;
+    delete[] state.lastSeen;
+    delete[] state.vertexRemap;
+    delete[] wideTriangles;
+}
+
+void ReorderTrianglesForCompression(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint16_t* reorderedTriangles,
+    uint32_t* trianglePermutation )
+{
+    ReorderTriangles< uint16_t >( triangles, triangleCount, vertexCount, reorderedTriangles, trianglePermutation );
+}
+
+void ReorderTrianglesForCompression(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t* reorderedTriangles,
+    uint32_t* trianglePermutation )
+{
+    ReorderTriangles< uint32_t >( triangles, triangleCount, vertexCount, reorderedTriangles, trianglePermutation );
+}
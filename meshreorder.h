@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef MESH_REORDER_H__
+#define MESH_REORDER_H__
+#pragma once
+
+#include <stdint.h>
+
+// Reorder the triangles of a mesh before compression, so that CompressMesh gets as many hits in its edge and vertex FIFOs as
+// possible. This is a greedy pass in the spirit of Tipsify/Forsyth vertex cache optimisation, but it emulates the compressor's
+// FIFOs and scores candidate triangles by their approximate encoded size, preferring triangles that share a recent edge
+// (the cheapest code to encode and decode), then ones using cached vertices, and avoiding free vertex references.
+// When it runs out of connected triangles, it restarts from a recently used vertex that still has triangles left.
+//
+// Only the order of the triangles changes (the vertices within each triangle are kept as they are), so the reordered mesh
+// is compressed with CompressMesh as usual. Note, this allocates working memory proportional to the vertex and triangle counts.
+//
+// This is aimed at meshes in a poor order (e.g. sorted by material, or from a tool that doesn't care about locality). Meshes
+// that are already in a tight scan order (like a regular grid in row order) can come out a little bigger, because the greedy
+// walk tends to spiral, so it's worth comparing the compressed sizes when the source order is already good.
+//
+// Parameters:
+//     [in]  triangles           - A typical triangle list index buffer (3 indices to vertices per triangle), 16 bit indices.
+//                                 Degenerate triangles are not supported (as with CompressMesh).
+//     [in]  triangleCount       - The number of triangles to process.
+//     [in]  vertexCount         - The number of vertices in the mesh.
+//     [out] reorderedTriangles  - The reordered triangle list, with triangleCount * 3 entries. Must not overlap triangles.
+//     [out] trianglePermutation - Optional (may be NULL), triangleCount entries, where trianglePermutation[ new triangle index ]
+//                                 gives the original index of the triangle.
+void ReorderTrianglesForCompression(
+    const uint16_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint16_t* reorderedTriangles,
+    uint32_t* trianglePermutation );
+
+// Same as above but 32bit indices.
+void ReorderTrianglesForCompression(
+    const uint32_t* triangles,
+    uint32_t triangleCount,
+    uint32_t vertexCount,
+    uint32_t* reorderedTriangles,
+    uint32_t* trianglePermutation );
+
+#endif // -- MESH_REORDER_H__
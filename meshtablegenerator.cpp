@@ -0,0 +1,630 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Generates the prefix code tables in indexbufferencodetables.h and indexbufferdecodetables.h from a corpus of meshes.
+//
+// Usage: meshtablegenerator [options] [.obj files or directories of them]
+//
+// Options:
+//     -o <directory>         Where to write the headers (default: the current directory).
+//     -tables <list>         Comma separated list of the tables to fit to the corpus; triangles, 16, 32 and 64 (the edge and
+//                            cached vertex tables for each FIFO size). Default: all of them. Tables that aren't listed keep
+//                            their current codes.
+//     -max-length <bits>     The longest code allowed in the fitted tables (default and at most LONGEST_PREFIX_CODE).
+//     -synthetic <triangles> Add the synthetic corpus from meshgenerator.h, with roughly this many triangles per mesh.
+//     -reorder               Also count each mesh after ReorderTrianglesForCompression.
+//
+// Only the faces of .obj files are used (polygons are split into fans, and degenerate triangles are skipped), as the attributes
+// don't change which codes the compressor picks. Each mesh is compressed with each FIFO size, with and without MCF_LONG_EDGES,
+// gathering the MeshCompressionStats histograms. These don't depend on the current tables, as the compressor always takes the
+// most recent match, so the tool can be run with whatever tables it was built with. The fitted codes are length limited
+// Huffman codes of the histograms, where every symbol is counted at least once so it still gets a code.
+//
+// Every decoding table (and its maximum code length) is built from the matching encoding table, so the two headers are always
+// consistent with each other. Note that fitting the triangles or 32 tables changes the default format, and fitting the 16 or
+// 64 tables changes the format for MCF_FIFO_16 or MCF_FIFO_64, so anything compressed with the old tables needs compressing
+// again.
+#include "meshcompression.h"
+#include "meshgenerator.h"
+#include "meshreorder.h"
+#include "prefixcodebuilder.h"
+#include "writebitstream.h"
+#include "indexcompressionconstants.h"
+#include "meshcompressionconstants.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#if defined( _MSC_VER )
+#include <io.h>
+#else
+#include <dirent.h>
+#endif
+
+// The current tables, which are kept for the tables that aren't fitted.
+#include "indexbufferencodetables.h"
+
+// A prefix code table in the generated headers.
+struct GeneratedTableInfo
+{
+    // The group of tables this belongs to, for -tables.
+    const char*       group;
+    const char*       encodeName;
+    const char*       encodeComment;
+    const char*       decodeName;
+    const char*       decodeComment;
+    const char*       maximumLengthName;
+    const PrefixCode* currentCodes;
+    uint32_t          symbolCount;
+};
+
+// The state for fitting a table, gathered over the corpus.
+struct GeneratedTable
+{
+    bool       fit;
+    uint64_t   counts[ MAX_PREFIX_CODE_SYMBOLS ];
+    PrefixCode codes[ MAX_PREFIX_CODE_SYMBOLS ];
+};
+
+enum GeneratedTableIndex
+{
+    GT_TRIANGLES,
+    GT_EDGES,
+    GT_CACHED_VERTICES,
+    GT_EDGES_16,
+    GT_CACHED_VERTICES_16,
+    GT_EDGES_64,
+    GT_CACHED_VERTICES_64,
+    GT_COUNT
+};
+
+static const GeneratedTableInfo TABLE_INFO[ GT_COUNT ] =
+{
+    {
+        "triangles", "TrianglePrefixCodes", "Prefix code table used for triangles",
+        "TriangleDecoding", "Prefix code decoding table used for triangle codes",
+        "TRIANGLE_MAX_CODE_LENGTH", TrianglePrefixCodes, MESH_TRIANGLE_CODE_COUNT
+    },
+    {
+        "32", "EdgePrefixCodes", "Prefix code table used for encoding edge bits",
+        "EdgeDecoding", "Prefix code decoding table used for edge fifo codes",
+        "EDGE_MAX_CODE_LENGTH", EdgePrefixCodes, 32
+    },
+    {
+        "32", "CachedVertexPrefixCodes", "Prefix code table used for vertices",
+        "VertexDecoding", "Prefix code decoding table used for vertex fifo codes.",
+        "VERTEX_MAX_CODE_LENGTH", CachedVertexPrefixCodes, 32
+    },
+    {
+        "16", "EdgePrefixCodes16", "Prefix code table used for encoding edge bits with a 16 entry edge FIFO (MCF_FIFO_16)",
+        "EdgeDecoding16", "Prefix code decoding table used for edge fifo codes with a 16 entry edge FIFO (MCF_FIFO_16)",
+        "EDGE_16_MAX_CODE_LENGTH", EdgePrefixCodes16, 16
+    },
+    {
+        "16", "CachedVertexPrefixCodes16", "Prefix code table used for vertices with a 16 entry vertex FIFO (MCF_FIFO_16)",
+        "VertexDecoding16", "Prefix code decoding table used for vertex fifo codes with a 16 entry vertex FIFO (MCF_FIFO_16)",
+        "VERTEX_16_MAX_CODE_LENGTH", CachedVertexPrefixCodes16, 16
+    },
+    {
+        "64", "EdgePrefixCodes64", "Prefix code table used for encoding edge bits with a 64 entry edge FIFO (MCF_FIFO_64)",
+        "EdgeDecoding64", "Prefix code decoding table used for edge fifo codes with a 64 entry edge FIFO (MCF_FIFO_64)",
+        "EDGE_64_MAX_CODE_LENGTH", EdgePrefixCodes64, 64
+    },
+    {
+        "64", "CachedVertexPrefixCodes64", "Prefix code table used for vertices with a 64 entry vertex FIFO (MCF_FIFO_64)",
+        "VertexDecoding64", "Prefix code decoding table used for vertex fifo codes with a 64 entry vertex FIFO (MCF_FIFO_64)",
+        "VERTEX_64_MAX_CODE_LENGTH", CachedVertexPrefixCodes64, 64
+    }
+};
+
+static GeneratedTable s_tables[ GT_COUNT ];
+
+// The order the tables are written in each header.
+static const GeneratedTableIndex ENCODE_ORDER[ GT_COUNT ] =
+{
+    GT_EDGES, GT_CACHED_VERTICES, GT_EDGES_16, GT_CACHED_VERTICES_16, GT_EDGES_64, GT_CACHED_VERTICES_64, GT_TRIANGLES
+};
+
+static const GeneratedTableIndex DECODE_ORDER[ GT_COUNT ] =
+{
+    GT_TRIANGLES, GT_CACHED_VERTICES, GT_EDGES, GT_EDGES_16, GT_CACHED_VERTICES_16, GT_EDGES_64, GT_CACHED_VERTICES_64
+};
+
+static const char* LICENSE =
+    "/*\n"
+    "Copyright (c) 2015, Conor Stokes\n"
+    "All rights reserved.\n"
+    "\n"
+    "Redistribution and use in source and binary forms, with or without\n"
+    "modification, are permitted provided that the following conditions are met:\n"
+    "\n"
+    "1. Redistributions of source code must retain the above copyright notice, this\n"
+    "list of conditions and the following disclaimer.\n"
+    "2. Redistributions in binary form must reproduce the above copyright notice,\n"
+    "this list of conditions and the following disclaimer in the documentation\n"
+    "and/or other materials provided with the distribution.\n"
+    "\n"
+    "THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\" AND\n"
+    "ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED\n"
+    "WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE\n"
+    "DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR\n"
+    "ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES\n"
+    "(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;\n"
+    "LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND\n"
+    "ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT\n"
+    "(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS\n"
+    "SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.\n"
+    "*/\n";
+
+// Count the codes used to compress a mesh with each FIFO size, with and without long edges.
+static void CountMesh( const uint32_t* triangles, uint32_t triangleCount, uint32_t vertexCount )
+{
+    static const uint32_t fifoFlags[ 3 ]    = { MCF_FIFO_16, 0, MCF_FIFO_64 };
+    static const uint32_t edgeTables[ 3 ]   = { GT_EDGES_16, GT_EDGES, GT_EDGES_64 };
+    static const uint32_t vertexTables[ 3 ] = { GT_CACHED_VERTICES_16, GT_CACHED_VERTICES, GT_CACHED_VERTICES_64 };
+
+    std::vector< uint32_t > vertexRemap( vertexCount );
+    int32_t                 noAttributes = 0;
+
+    for ( uint32_t fifo = 0; fifo < 3; ++fifo )
+    {
+        for ( uint32_t longEdges = 0; longEdges < 2; ++longEdges )
+        {
+            WriteBitstream         output( 64 * 1024 );
+            MeshCompressionStats   stats;
+            MeshCompressionOptions options;
+
+            options.flags = fifoFlags[ fifo ] | ( longEdges != 0 ? MCF_LONG_EDGES : 0 );
+            options.stats = &stats;
+
+            CompressMesh( triangles, triangleCount, &vertexRemap[ 0 ], vertexCount, 0, &noAttributes, output, options );
+
+            GeneratedTable& edges    = s_tables[ edgeTables[ fifo ] ];
+            GeneratedTable& vertices = s_tables[ vertexTables[ fifo ] ];
+
+            for ( uint32_t symbol = 0; symbol < TABLE_INFO[ edgeTables[ fifo ] ].symbolCount; ++symbol )
+            {
+                edges.counts[ symbol ]    += stats.edgeDistances[ symbol ];
+                vertices.counts[ symbol ] += stats.cachedVertexDistances[ symbol ];
+            }
+
+            // The triangle codes are shared by all of the FIFO sizes, so count them at the default.
+            if ( fifoFlags[ fifo ] == 0 )
+            {
+                for ( uint32_t symbol = 0; symbol < MESH_TRIANGLE_CODE_COUNT; ++symbol )
+                {
+                    s_tables[ GT_TRIANGLES ].counts[ symbol ] += stats.triangleCodes[ symbol ];
+                }
+            }
+        }
+    }
+}
+
+// Count a mesh, and its reordered version with -reorder.
+static void AddMesh( const char* name, const std::vector< uint32_t >& triangles, uint32_t vertexCount, bool reorder )
+{
+    uint32_t triangleCount = static_cast< uint32_t >( triangles.size() / 3 );
+
+    if ( triangleCount == 0 )
+    {
+        return;
+    }
+
+    printf( "%-40s %u triangles, %u vertices\n", name, triangleCount, vertexCount );
+
+    CountMesh( &triangles[ 0 ], triangleCount, vertexCount );
+
+    if ( reorder )
+    {
+        std::vector< uint32_t > reordered( triangles.size() );
+
+        ReorderTrianglesForCompression( &triangles[ 0 ], triangleCount, vertexCount, &reordered[ 0 ], NULL );
+
+        CountMesh( &reordered[ 0 ], triangleCount, vertexCount );
+    }
+}
+
+// Load the faces of an .obj file as a triangle list, returning false if it can't be read.
+static bool LoadObj( const char* path, std::vector< uint32_t >& triangles, uint32_t& vertexCount )
+{
+    FILE* file = fopen( path, "r" );
+
+    if ( file == NULL )
+    {
+        return false;
+    }
+
+    static char line[ 64 * 1024 ];
+
+    std::vector< uint32_t > face;
+
+    triangles.clear();
+    vertexCount = 0;
+
+    uint32_t declaredVertices = 0;
+
+    while ( fgets( line, sizeof( line ), file ) != NULL )
+    {
+        if ( line[ 0 ] == 'v' && ( line[ 1 ] == ' ' || line[ 1 ] == '\t' ) )
+        {
+            ++declaredVertices;
+            continue;
+        }
+
+        if ( line[ 0 ] != 'f' || ( line[ 1 ] != ' ' && line[ 1 ] != '\t' ) )
+        {
+            continue;
+        }
+
+        face.clear();
+
+        // Each vertex is "v", "v/vt", "v//vn" or "v/vt/vn", where negative indices are relative to the last vertex declared.
+        for ( char* token = strtok( line + 1, " \t\r\n" ); token != NULL; token = strtok( NULL, " \t\r\n" ) )
+        {
+            long index = strtol( token, NULL, 10 );
+
+            if ( index > 0 )
+            {
+                face.push_back( static_cast< uint32_t >( index - 1 ) );
+            }
+            else if ( index < 0 && static_cast< uint32_t >( -index ) <= declaredVertices )
+            {
+                face.push_back( static_cast< uint32_t >( declaredVertices + index ) );
+            }
+        }
+
+        for ( size_t corner = 2; corner < face.size(); ++corner )
+        {
+            uint32_t a = face[ 0 ];
+            uint32_t b = face[ corner - 1 ];
+            uint32_t c = face[ corner ];
+
+            // CompressMesh doesn't support degenerate triangles.
+            if ( a == b || b == c || c == a )
+            {
+                continue;
+            }
+
+            triangles.push_back( a );
+            triangles.push_back( b );
+            triangles.push_back( c );
+
+            uint32_t highest = a > b ? ( a > c ? a : c ) : ( b > c ? b : c );
+
+            vertexCount = highest >= vertexCount ? highest + 1 : vertexCount;
+        }
+    }
+
+    fclose( file );
+
+    vertexCount = declaredVertices > vertexCount ? declaredVertices : vertexCount;
+
+    return true;
+}
+
+static bool IsObjFile( const std::string& name )
+{
+    return name.size() > 4 &&
+           ( name.compare( name.size() - 4, 4, ".obj" ) == 0 || name.compare( name.size() - 4, 4, ".OBJ" ) == 0 );
+}
+
+// List the .obj files in a directory, returning false if it isn't one.
+static bool ListObjFiles( const std::string& directory, std::vector< std::string >& files )
+{
+#if defined( _MSC_VER )
+
+    _finddata_t found;
+    intptr_t    search = _findfirst( ( directory + "/*" ).c_str(), &found );
+
+    if ( search == -1 )
+    {
+        return false;
+    }
+
+    do
+    {
+        if ( ( found.attrib & _A_SUBDIR ) == 0 && IsObjFile( found.name ) )
+        {
+            files.push_back( directory + "/" + found.name );
+        }
+    }
+    while ( _findnext( search, &found ) == 0 );
+
+    _findclose( search );
+
+#else
+
+    DIR* dir = opendir( directory.c_str() );
+
+    if ( dir == NULL )
+    {
+        return false;
+    }
+
+    for ( dirent* entry = readdir( dir ); entry != NULL; entry = readdir( dir ) )
+    {
+        if ( IsObjFile( entry->d_name ) )
+        {
+            files.push_back( directory + "/" + entry->d_name );
+        }
+    }
+
+    closedir( dir );
+
+#endif
+
+    return true;
+}
+
+// Fit a table's codes to its counts, or keep its current codes.
+static void BuildTableCodes( const GeneratedTableInfo& info, GeneratedTable& table, uint32_t maximumCodeLength )
+{
+    if ( !table.fit )
+    {
+        memcpy( table.codes, info.currentCodes, sizeof( PrefixCode ) * info.symbolCount );
+        return;
+    }
+
+    uint64_t highest = 0;
+
+    for ( uint32_t symbol = 0; symbol < info.symbolCount; ++symbol )
+    {
+        highest = table.counts[ symbol ] > highest ? table.counts[ symbol ] : highest;
+    }
+
+    // Scale the counts down to fit in 32 bits if need be, then count every symbol at least once.
+    uint32_t shift = 0;
+
+    while ( ( highest >> shift ) >= 0x7FFFFFFF )
+    {
+        ++shift;
+    }
+
+    uint32_t counts[ MAX_PREFIX_CODE_SYMBOLS ];
+    uint8_t  codeLengths[ MAX_PREFIX_CODE_SYMBOLS ];
+
+    for ( uint32_t symbol = 0; symbol < info.symbolCount; ++symbol )
+    {
+        counts[ symbol ] = static_cast< uint32_t >( table.counts[ symbol ] >> shift ) + 1;
+    }
+
+    BuildPrefixCodeLengths( counts, info.symbolCount, maximumCodeLength, codeLengths );
+    BuildPrefixCodes( codeLengths, info.symbolCount, table.codes );
+}
+
+static void WriteHeaderStart( FILE* file, const char* includedIn )
+{
+    fprintf( file, "%s\n", LICENSE );
+    fprintf( file, "// NOTE - these tables are in this file for readability / navagability and should *only* be included in\n" );
+    fprintf( file, "// %s\n", includedIn );
+    fprintf( file, "//\n" );
+    fprintf( file, "// Generated by meshtablegenerator.cpp, which keeps the encoding and decoding tables consistent, so regenerate them\n" );
+    fprintf( file, "// with it rather than editing them by hand.\n\n" );
+    fprintf( file, "#pragma once\n" );
+}
+
+static bool WriteEncodeHeader( const std::string& path )
+{
+    FILE* file = fopen( path.c_str(), "w" );
+
+    if ( file == NULL )
+    {
+        return false;
+    }
+
+    WriteHeaderStart( file, "indexbuffercompression.cpp for index buffer compression and meshcompression.cpp for mesh compression" );
+
+    for ( uint32_t order = 0; order < GT_COUNT; ++order )
+    {
+        const GeneratedTableInfo& info  = TABLE_INFO[ ENCODE_ORDER[ order ] ];
+        const GeneratedTable&     table = s_tables[ ENCODE_ORDER[ order ] ];
+
+        fprintf( file, "\n// %s\nstatic const PrefixCode %s[] =\n{\n", info.encodeComment, info.encodeName );
+
+        for ( uint32_t symbol = 0; symbol < info.symbolCount; ++symbol )
+        {
+            fprintf( file, "    { %u, %u }%s\n", table.codes[ symbol ].code, table.codes[ symbol ].bitLength, symbol + 1 < info.symbolCount ? "," : "" );
+        }
+
+        fprintf( file, "};\n" );
+    }
+
+    fclose( file );
+
+    return true;
+}
+
+static bool WriteDecodeHeader( const std::string& path )
+{
+    FILE* file = fopen( path.c_str(), "w" );
+
+    if ( file == NULL )
+    {
+        return false;
+    }
+
+    static PrefixCodeTableEntry decoding[ GT_COUNT ][ 1 << MAX_PREFIX_CODE_LENGTH ];
+    uint32_t                    maximumCodeLengths[ GT_COUNT ];
+
+    for ( uint32_t index = 0; index < GT_COUNT; ++index )
+    {
+        maximumCodeLengths[ index ] = BuildPrefixCodeDecodingTable( s_tables[ index ].codes, TABLE_INFO[ index ].symbolCount, decoding[ index ] );
+    }
+
+    WriteHeaderStart( file, "indexbufferdecompression.cpp for index buffer compression and meshdecompression.cpp for mesh compression" );
+
+    fprintf( file, "\n// The longest code in each decoding table, which is the number of bits looked up at a time.\n" );
+
+    for ( uint32_t order = 0; order < GT_COUNT; ++order )
+    {
+        const GeneratedTableInfo& info = TABLE_INFO[ DECODE_ORDER[ order ] ];
+
+        fprintf( file, "static const uint32_t %-25s = %u;\n", info.maximumLengthName, maximumCodeLengths[ DECODE_ORDER[ order ] ] );
+    }
+
+    for ( uint32_t order = 0; order < GT_COUNT; ++order )
+    {
+        const GeneratedTableInfo&   info    = TABLE_INFO[ DECODE_ORDER[ order ] ];
+        const PrefixCodeTableEntry* entries = decoding[ DECODE_ORDER[ order ] ];
+        uint32_t                    size    = 1u << maximumCodeLengths[ DECODE_ORDER[ order ] ];
+
+        fprintf( file, "\n// %s\nstatic const PrefixCodeTableEntry %s[] =\n{\n", info.decodeComment, info.decodeName );
+
+        for ( uint32_t entry = 0; entry < size; ++entry )
+        {
+            fprintf( file, "    { %u, %u }%s\n", entries[ entry ].original, entries[ entry ].codeLength, entry + 1 < size ? "," : "" );
+        }
+
+        fprintf( file, "};\n" );
+    }
+
+    fclose( file );
+
+    return true;
+}
+
+static int Usage( const char* program )
+{
+    fprintf( stderr, "usage: %s [-o directory] [-tables triangles,16,32,64] [-max-length bits] [-synthetic triangles] [-reorder] [.obj files or directories]\n", program );
+    return 1;
+}
+
+int main( int argc, char** argv )
+{
+    std::string                outputDirectory   = ".";
+    std::string                tables            = "triangles,16,32,64";
+    uint32_t                   maximumCodeLength = LONGEST_PREFIX_CODE;
+    uint32_t                   syntheticSize     = 0;
+    bool                       reorder           = false;
+    std::vector< std::string > paths;
+
+    for ( int argument = 1; argument < argc; ++argument )
+    {
+        bool hasValue = argument + 1 < argc;
+
+        if ( strcmp( argv[ argument ], "-o" ) == 0 && hasValue )
+        {
+            outputDirectory = argv[ ++argument ];
+        }
+        else if ( strcmp( argv[ argument ], "-tables" ) == 0 && hasValue )
+        {
+            tables = argv[ ++argument ];
+        }
+        else if ( strcmp( argv[ argument ], "-max-length" ) == 0 && hasValue )
+        {
+            maximumCodeLength = static_cast< uint32_t >( atoi( argv[ ++argument ] ) );
+        }
+        else if ( strcmp( argv[ argument ], "-synthetic" ) == 0 && hasValue )
+        {
+            syntheticSize = static_cast< uint32_t >( atoi( argv[ ++argument ] ) );
+        }
+        else if ( strcmp( argv[ argument ], "-reorder" ) == 0 )
+        {
+            reorder = true;
+        }
+        else if ( argv[ argument ][ 0 ] == '-' )
+        {
+            return Usage( argv[ 0 ] );
+        }
+        else
+        {
+            paths.push_back( argv[ argument ] );
+        }
+    }
+
+    // 64 symbols need codes of at least 6 bits.
+    if ( maximumCodeLength < 6 || maximumCodeLength > LONGEST_PREFIX_CODE || ( paths.empty() && syntheticSize == 0 ) )
+    {
+        return Usage( argv[ 0 ] );
+    }
+
+    for ( uint32_t index = 0; index < GT_COUNT; ++index )
+    {
+        std::string list = "," + tables + ",";
+
+        s_tables[ index ].fit = list.find( std::string( "," ) + TABLE_INFO[ index ].group + "," ) != std::string::npos;
+    }
+
+    std::vector< uint32_t > triangles;
+    uint32_t                vertexCount;
+
+    for ( size_t path = 0; path < paths.size(); ++path )
+    {
+        std::vector< std::string > files;
+
+        if ( !ListObjFiles( paths[ path ], files ) )
+        {
+            files.push_back( paths[ path ] );
+        }
+
+        for ( size_t file = 0; file < files.size(); ++file )
+        {
+            if ( !LoadObj( files[ file ].c_str(), triangles, vertexCount ) )
+            {
+                fprintf( stderr, "couldn't read %s\n", files[ file ].c_str() );
+                return 1;
+            }
+
+            AddMesh( files[ file ].c_str(), triangles, vertexCount, reorder );
+        }
+    }
+
+    if ( syntheticSize > 0 )
+    {
+        MeshGeneratorParameters      parameters;
+        std::vector< GeneratedMesh > corpus;
+
+        parameters.vertexAttributeCount = 0;
+        parameters.attributeBits        = 14;
+        parameters.seed                 = 1;
+
+        GenerateMeshCorpus( syntheticSize, parameters, corpus );
+
+        for ( size_t mesh = 0; mesh < corpus.size(); ++mesh )
+        {
+            AddMesh( corpus[ mesh ].name, corpus[ mesh ].triangles, corpus[ mesh ].vertexCount, reorder );
+        }
+    }
+
+    for ( uint32_t index = 0; index < GT_COUNT; ++index )
+    {
+        BuildTableCodes( TABLE_INFO[ index ], s_tables[ index ], maximumCodeLength );
+    }
+
+    std::string encodePath = outputDirectory + "/indexbufferencodetables.h";
+    std::string decodePath = outputDirectory + "/indexbufferdecodetables.h";
+
+    if ( !WriteEncodeHeader( encodePath ) || !WriteDecodeHeader( decodePath ) )
+    {
+        fprintf( stderr, "couldn't write the headers to %s\n", outputDirectory.c_str() );
+        return 1;
+    }
+
+    printf( "wrote %s and %s\n", encodePath.c_str(), decodePath.c_str() );
+
+    return 0;
+}
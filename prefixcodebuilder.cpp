@@ -0,0 +1,279 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#include "prefixcodebuilder.h"
+#include <assert.h>
+#include <string.h>
+
+// Value for Huffman tree nodes that haven't been merged yet.
+static const uint32_t NO_PARENT = 0xFFFFFFFF;
+
+void BuildPrefixCodeLengths( const uint32_t* counts, uint32_t symbolCount, uint32_t maximumCodeLength, uint8_t* codeLengths )
+{
+    assert( symbolCount <= MAX_PREFIX_CODE_SYMBOLS );
+    assert( maximumCodeLength <= MAX_PREFIX_CODE_LENGTH && ( 1u << maximumCodeLength ) >= symbolCount );
+
+    // The used symbols, most frequent first (ties in symbol order).
+    uint32_t symbols[ MAX_PREFIX_CODE_SYMBOLS ];
+    uint32_t usedCount = 0;
+
+    ::memset( codeLengths, 0, symbolCount );
+
+    for ( uint32_t symbol = 0; symbol < symbolCount; ++symbol )
+    {
+        if ( counts[ symbol ] == 0 )
+        {
+            continue;
+        }
+
+        uint32_t where = usedCount++;
+
+        for ( ; where > 0 && counts[ symbols[ where - 1 ] ] < counts[ symbol ]; --where )
+        {
+            symbols[ where ] = symbols[ where - 1 ];
+        }
+
+        symbols[ where ] = symbol;
+    }
+
+    if ( usedCount < 2 )
+    {
+        if ( usedCount == 1 )
+        {
+            codeLengths[ symbols[ 0 ] ] = 1;
+        }
+
+        return;
+    }
+
+    // Build the Huffman tree, where the leaves are the used symbols in the order above and the internal nodes follow them, by
+    // repeatedly merging the two lightest nodes. There are few enough symbols that a linear search for them is fine.
+    uint64_t weights[ MAX_PREFIX_CODE_SYMBOLS * 2 ];
+    uint32_t parents[ MAX_PREFIX_CODE_SYMBOLS * 2 ];
+    uint32_t nodeCount = usedCount;
+
+    for ( uint32_t leaf = 0; leaf < usedCount; ++leaf )
+    {
+        weights[ leaf ] = counts[ symbols[ leaf ] ];
+        parents[ leaf ] = NO_PARENT;
+    }
+
+    for ( ; nodeCount < ( usedCount * 2 ) - 1; ++nodeCount )
+    {
+        uint32_t lightest[ 2 ] = { NO_PARENT, NO_PARENT };
+
+        for ( uint32_t node = 0; node < nodeCount; ++node )
+        {
+            if ( parents[ node ] != NO_PARENT )
+            {
+                continue;
+            }
+
+            if ( lightest[ 0 ] == NO_PARENT || weights[ node ] < weights[ lightest[ 0 ] ] )
+            {
+                lightest[ 1 ] = lightest[ 0 ];
+                lightest[ 0 ] = node;
+            }
+            else if ( lightest[ 1 ] == NO_PARENT || weights[ node ] < weights[ lightest[ 1 ] ] )
+            {
+                lightest[ 1 ] = node;
+            }
+        }
+
+        weights[ nodeCount ]     = weights[ lightest[ 0 ] ] + weights[ lightest[ 1 ] ];
+        parents[ nodeCount ]     = NO_PARENT;
+        parents[ lightest[ 0 ] ] = nodeCount;
+        parents[ lightest[ 1 ] ] = nodeCount;
+    }
+
+    // Count the leaves at each depth.
+    uint32_t lengthCounts[ MAX_PREFIX_CODE_SYMBOLS ] = {};
+    uint32_t longestLength                           = 0;
+
+    for ( uint32_t leaf = 0; leaf < usedCount; ++leaf )
+    {
+        uint32_t length = 0;
+
+        for ( uint32_t node = leaf; parents[ node ] != NO_PARENT; node = parents[ node ] )
+        {
+            ++length;
+        }
+
+        ++lengthCounts[ length ];
+
+        longestLength = length > longestLength ? length : longestLength;
+    }
+
+    // Limit the lengths the same way as JPEG (Annex K.3); take two leaves from the longest length, putting one of them a level up
+    // and the other (with its new sibling) under a leaf from a shorter length, which keeps the code complete.
+    for ( uint32_t length = longestLength; length > maximumCodeLength; --length )
+    {
+        while ( lengthCounts[ length ] > 0 )
+        {
+            uint32_t shorter = length - 2;
+
+            while ( lengthCounts[ shorter ] == 0 )
+            {
+                --shorter;
+            }
+
+            lengthCounts[ length ]      -= 2;
+            lengthCounts[ length - 1 ]  += 1;
+            lengthCounts[ shorter + 1 ] += 2;
+            lengthCounts[ shorter ]     -= 1;
+        }
+    }
+
+    // Hand out the lengths, shortest first, to the symbols from most to least frequent.
+    uint32_t leaf = 0;
+
+    for ( uint32_t length = 1; length <= maximumCodeLength; ++length )
+    {
+        for ( uint32_t count = 0; count < lengthCounts[ length ]; ++count, ++leaf )
+        {
+            codeLengths[ symbols[ leaf ] ] = static_cast< uint8_t >( length );
+        }
+    }
+
+    assert( leaf == usedCount );
+}
+
+void BuildPrefixCodes( const uint8_t* codeLengths, uint32_t symbolCount, PrefixCode* codes )
+{
+    assert( symbolCount <= MAX_PREFIX_CODE_SYMBOLS );
+
+    uint32_t code = 0;
+
+    ::memset( codes, 0, sizeof( PrefixCode ) * symbolCount );
+
+    for ( uint32_t length = 1; length <= MAX_PREFIX_CODE_LENGTH; ++length, code <<= 1 )
+    {
+        for ( uint32_t symbol = 0; symbol < symbolCount; ++symbol )
+        {
+            if ( codeLengths[ symbol ] != length )
+            {
+                continue;
+            }
+
+            // Canonical codes are assigned most significant bit first, but the bitstreams read prefix codes from the least
+            // significant bit up, so reverse them.
+            uint32_t reversed = 0;
+
+            for ( uint32_t bit = 0; bit < length; ++bit )
+            {
+                reversed |= ( ( code >> bit ) & 1 ) << ( ( length - 1 ) - bit );
+            }
+
+            codes[ symbol ].code      = reversed;
+            codes[ symbol ].bitLength = length;
+
+            ++code;
+        }
+    }
+}
+
+uint32_t BuildPrefixCodeDecodingTable( const PrefixCode* codes, uint32_t symbolCount, PrefixCodeTableEntry* table )
+{
+    uint32_t maximumCodeLength = 0;
+
+    for ( uint32_t symbol = 0; symbol < symbolCount; ++symbol )
+    {
+        maximumCodeLength = codes[ symbol ].bitLength > maximumCodeLength ? codes[ symbol ].bitLength : maximumCodeLength;
+    }
+
+    // Entries that no code maps to (when only one symbol is used) are left empty.
+    ::memset( table, 0, sizeof( PrefixCodeTableEntry ) << maximumCodeLength );
+
+    // Every entry whose low bits are a symbol's code decodes to that symbol.
+    for ( uint32_t symbol = 0; symbol < symbolCount; ++symbol )
+    {
+        uint32_t length = codes[ symbol ].bitLength;
+
+        if ( length == 0 )
+        {
+            continue;
+        }
+
+        for ( uint32_t high = 0; high < ( 1u << ( maximumCodeLength - length ) ); ++high )
+        {
+            PrefixCodeTableEntry& entry = table[ codes[ symbol ].code | ( high << length ) ];
+
+            entry.original   = static_cast< uint8_t >( symbol );
+            entry.codeLength = static_cast< uint8_t >( length );
+        }
+    }
+
+    return maximumCodeLength;
+}
+
+uint32_t BuildPrefixCodeDecodingTable( const uint8_t* codeLengths, uint32_t symbolCount, PrefixCodeTableEntry* table )
+{
+    PrefixCode codes[ MAX_PREFIX_CODE_SYMBOLS ];
+
+    BuildPrefixCodes( codeLengths, symbolCount, codes );
+
+    return BuildPrefixCodeDecodingTable( codes, symbolCount, table );
+}
+
+void BuildPairedPrefixCodeDecodingTable(
+    const PrefixCodeTableEntry* first,
+    uint32_t firstMaximumCodeLength,
+    uint64_t pairedSymbols,
+    const PrefixCodeTableEntry* second,
+    uint32_t secondMaximumCodeLength,
+    uint32_t tableCodeLength,
+    PairedPrefixCodeTableEntry* table )
+{
+    assert( firstMaximumCodeLength <= tableCodeLength );
+
+    uint32_t firstMask  = ( 1u << firstMaximumCodeLength ) - 1;
+    uint32_t secondMask = ( 1u << secondMaximumCodeLength ) - 1;
+
+    for ( uint32_t bits = 0; bits < ( 1u << tableCodeLength ); ++bits )
+    {
+        const PrefixCodeTableEntry& firstEntry = first[ bits & firstMask ];
+        PairedPrefixCodeTableEntry& entry      = table[ bits ];
+
+        entry.first      = firstEntry.original;
+        entry.second     = PREFIX_CODE_NOT_PAIRED;
+        entry.codeLength = firstEntry.codeLength;
+        entry.padding    = 0;
+
+        if ( ( ( pairedSymbols >> firstEntry.original ) & 1 ) == 0 )
+        {
+            continue;
+        }
+
+        // Only the bits left over after the first code are known, but if the second code fits in those, it's the only code
+        // that matches them (as the codes are prefix free).
+        uint32_t                    bitsLeft    = tableCodeLength - firstEntry.codeLength;
+        const PrefixCodeTableEntry& secondEntry = second[ ( bits >> firstEntry.codeLength ) & secondMask ];
+
+        if ( secondEntry.codeLength <= bitsLeft && secondEntry.codeLength > 0 )
+        {
+            entry.second      = secondEntry.original;
+            entry.codeLength += secondEntry.codeLength;
+        }
+    }
+}
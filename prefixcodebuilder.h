@@ -0,0 +1,79 @@
+/*
+Copyright (c) 2015, Conor Stokes
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef PREFIX_CODE_BUILDER_H__
+#define PREFIX_CODE_BUILDER_H__
+#pragma once
+
+#include <stdint.h>
+#include "writebitstream.h"
+#include "readbitstream.h"
+
+// Building prefix codes from symbol counts, for the tables written by WriteBitstream::WritePrefixCode and read by
+// ReadBitstream::Decode. Codes are canonical (shorter codes first, then in symbol order), so a code is described entirely by
+// the length of each symbol's code, where a length of 0 is a symbol that isn't used.
+
+// The most symbols in a prefix code, and the longest code length supported.
+const uint32_t MAX_PREFIX_CODE_SYMBOLS = 64;
+const uint32_t MAX_PREFIX_CODE_LENGTH  = 15;
+
+// Build length limited code lengths (Huffman, with the lengths over the limit adjusted down) from the count of each symbol.
+// Symbols with a count of 0 get a length of 0; if only one symbol is used, it gets a 1 bit code.
+// Parameters:
+//     [in]  counts            - The number of times each symbol occurs.
+//     [in]  symbolCount       - The number of symbols, up to MAX_PREFIX_CODE_SYMBOLS.
+//     [in]  maximumCodeLength - The longest code allowed, up to MAX_PREFIX_CODE_LENGTH, with 2^maximumCodeLength >= symbolCount.
+//     [out] codeLengths       - The code length for each symbol.
+void BuildPrefixCodeLengths( const uint32_t* counts, uint32_t symbolCount, uint32_t maximumCodeLength, uint8_t* codeLengths );
+
+// Build the canonical codes for a set of code lengths, for WriteBitstream::WritePrefixCode (symbols of length 0 get an empty code).
+void BuildPrefixCodes( const uint8_t* codeLengths, uint32_t symbolCount, PrefixCode* codes );
+
+// Build the decoding table for a set of code lengths, for ReadBitstream::Decode, returning the maximum code length to decode
+// with. The table must have room for 2^(longest code length) entries.
+uint32_t BuildPrefixCodeDecodingTable( const uint8_t* codeLengths, uint32_t symbolCount, PrefixCodeTableEntry* table );
+
+// Same as above, but from the codes themselves, which don't have to be canonical (just prefix free).
+uint32_t BuildPrefixCodeDecodingTable( const PrefixCode* codes, uint32_t symbolCount, PrefixCodeTableEntry* table );
+
+// Build a paired decoding table for ReadBitstream::DecodePair from two decoding tables, where each entry decodes a code from the
+// first table and, if it is one of the pairedSymbols (a bit mask) and the code from the second table after it fits, that code too.
+// Parameters:
+//     [in]  first                   - The decoding table for the first code.
+//     [in]  firstMaximumCodeLength  - The maximum code length of the first table, which must be tableCodeLength or less.
+//     [in]  pairedSymbols           - The symbols of the first code that the second code follows, a bit per symbol.
+//     [in]  second                  - The decoding table for the second code.
+//     [in]  secondMaximumCodeLength - The maximum code length of the second table.
+//     [in]  tableCodeLength         - The number of bits the paired table looks up at a time.
+//     [out] table                   - The paired table, which must have room for 2^tableCodeLength entries.
+void BuildPairedPrefixCodeDecodingTable(
+    const PrefixCodeTableEntry* first,
+    uint32_t firstMaximumCodeLength,
+    uint64_t pairedSymbols,
+    const PrefixCodeTableEntry* second,
+    uint32_t secondMaximumCodeLength,
+    uint32_t tableCodeLength,
+    PairedPrefixCodeTableEntry* table );
+
+#endif // -- PREFIX_CODE_BUILDER_H__
@@ -69,6 +69,19 @@ struct PrefixCodeTableEntry
     uint8_t codeLength;
 };
 
+// Used for representing an entry in a decoding table for a pair of prefix codes, where the second code follows the first. The
+// second code is only decoded with the first when the first is one that it follows and both fit in the table's bits, otherwise
+// second is PREFIX_CODE_NOT_PAIRED. The code length covers both codes.
+struct PairedPrefixCodeTableEntry
+{
+    uint8_t first;
+    uint8_t second;
+    uint8_t codeLength;
+    uint8_t padding;
+};
+
+const uint8_t PREFIX_CODE_NOT_PAIRED = 0xFF;
+
 // Very simple reader bitstream, note it does not do any overflow checking, etc.
 class ReadBitstream
 {
@@ -85,6 +98,9 @@ public:
     // Get the buffer size of this in bytes
     size_t Size() const { return m_bufferSize; }
 
+    // Get the number of bits read so far.
+    size_t Position() const { return ( ( m_cursor - m_buffer ) * 8 ) - m_bitsLeft; }
+
     // Read a variable encoded int (use MSB of each byte to signal another byte
     uint32_t ReadVInt();
 
@@ -93,6 +109,10 @@ public:
     // Also note, this uses 4 byte reads/only partially refills the bit-buffer.
     uint32_t Decode( const PrefixCodeTableEntry* table, const uint32_t maximumCodeLength );
 
+    // Decode a pair of prefix codes using a paired table (least significant bits lookup), which is tableCodeLength bits wide.
+    // The same notes as Decode apply.
+    PairedPrefixCodeTableEntry DecodePair( const PairedPrefixCodeTableEntry* table, const uint32_t tableCodeLength );
+
     // Decode a unsigned integer encoded exponential golomb like universal code, where the range of valid values is 0 to 2147483647,
     // read from the bit stream.
     uint32_t DecodeUniversal( uint32_t k );
@@ -109,6 +129,8 @@ public:
 
 private:
 
+    // Make sure there are at least maximumCodeSize bits in the bit-buffer, for Decode and DecodePair.
+    void RefillForDecode( uint32_t maximumCodeSize );
 
     uint64_t m_bitBuffer;
 
@@ -138,7 +160,7 @@ RBS_INLINE uint32_t ReadBitstream::Log2( uint32_t input )
 
 #elif defined( __GNUC__ ) || defined( __clang__ )
 
-    return static_cast< uint32_t >( 31 - __builtin_clz( static_cast< unsigned int >( m_bitBuffer ) ) );
+    return static_cast< uint32_t >( 31 - __builtin_clz( static_cast< unsigned int >( input ) ) );
 
 #else
 
@@ -247,7 +269,7 @@ RBS_INLINE uint32_t ReadBitstream::DecodeUniversal( uint32_t k )
 }
 
 
-RBS_INLINE uint32_t ReadBitstream::Decode( const PrefixCodeTableEntry* table, uint32_t maximumCodeSize )
+RBS_INLINE void ReadBitstream::RefillForDecode( uint32_t maximumCodeSize )
 {
     if ( m_bitsLeft < maximumCodeSize )
     {
@@ -272,6 +294,11 @@ RBS_INLINE uint32_t ReadBitstream::Decode( const PrefixCodeTableEntry* table, ui
         m_bitsLeft            += 32;
         m_cursor              += 4;
     }
+}
+
+RBS_INLINE uint32_t ReadBitstream::Decode( const PrefixCodeTableEntry* table, uint32_t maximumCodeSize )
+{
+    RefillForDecode( maximumCodeSize );
 
     // mask should be constant collasped due to maximumCodeSize being fixed and this being inlined.
     const uint64_t              mask       = ( uint64_t( 1 ) << maximumCodeSize ) - 1;
@@ -284,6 +311,19 @@ RBS_INLINE uint32_t ReadBitstream::Decode( const PrefixCodeTableEntry* table, ui
     return codeEntry.original;
 }
 
+RBS_INLINE PairedPrefixCodeTableEntry ReadBitstream::DecodePair( const PairedPrefixCodeTableEntry* table, uint32_t tableCodeLength )
+{
+    RefillForDecode( tableCodeLength );
+
+    const uint64_t             mask      = ( uint64_t( 1 ) << tableCodeLength ) - 1;
+    PairedPrefixCodeTableEntry codeEntry = table[ m_bitBuffer & mask ];
+
+    m_bitBuffer >>= codeEntry.codeLength;
+    m_bitsLeft   -= codeEntry.codeLength;
+
+    return codeEntry;
+}
+
 
 inline ReadBitstream::ReadBitstream( const uint8_t* buffer, size_t bufferSize )
 {
@@ -307,7 +347,8 @@ inline ReadBitstream::ReadBitstream( const uint8_t* buffer, size_t bufferSize )
     }
     else
     {
-        m_bitsLeft = 0;
+        m_bitBuffer = 0;
+        m_bitsLeft  = 0;
     }
 }
 
@@ -28,6 +28,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include <memory.h>
 #include <assert.h>
 
@@ -51,6 +52,36 @@ struct PrefixCode
     uint32_t bitLength;
 };
 
+// Allocator hook for the buffers a WriteBitstream grows into (e.g. from an arena). Allocate returns a buffer of at least the
+// requested size, which Free (if not NULL) is later given back. Both get the user pointer along with the buffer.
+struct WriteBitstreamAllocator
+{
+    uint8_t* ( *Allocate )( size_t size, void* user );
+    void     ( *Free )( uint8_t* buffer, void* user );
+    void*    user;
+};
+
+// Sink for a stream that hands its output on as it goes (e.g. to a file), instead of keeping all of it in memory. Write is given
+// each full buffer in turn and then, when the stream is finished, the rest of it. It also gets the user pointer.
+struct WriteBitstreamSink
+{
+    void  ( *Write )( const uint8_t* data, size_t size, void* user );
+    void* user;
+};
+
+// Sink writing to a stdio file, which is the user pointer. Check ferror on the file once the stream is finished.
+inline void WriteBitstreamFileSinkWrite( const uint8_t* data, size_t size, void* user )
+{
+    fwrite( data, 1, size, static_cast< FILE* >( user ) );
+}
+
+inline WriteBitstreamSink WriteBitstreamFileSink( FILE* file )
+{
+    WriteBitstreamSink sink = { WriteBitstreamFileSinkWrite, file };
+
+    return sink;
+}
+
 // Very simple bitstream for writing that will grow to accommodate written bits.
 class WriteBitstream
 {
@@ -59,17 +90,36 @@ public:
     // Construct the bit stream with an initial buffer capacity - should be a multiple of 8 and > 0
     WriteBitstream( size_t initialBufferCapacity = 16 )
     {
-        m_bufferCursor =
-        m_buffer       = new uint8_t[ initialBufferCapacity ];
-        m_bufferEnd    = m_buffer + initialBufferCapacity;
-        m_size         = 0;
-        m_bitsLeft     = 64;
-        m_bitBuffer    = 0;
+        Initialise( NULL, initialBufferCapacity, NULL );
+    }
+
+    // Same as above, but the buffers come from the allocator (which is copied, so it doesn't need to outlive the stream).
+    WriteBitstream( size_t initialBufferCapacity, const WriteBitstreamAllocator& allocator )
+    {
+        Initialise( NULL, initialBufferCapacity, &allocator );
+    }
+
+    // Write into a caller owned buffer of bufferCapacity bytes (a multiple of 8 and > 0), which the stream never frees. Sized
+    // for the worst case (see CompressMeshBound), nothing is allocated or copied. Otherwise, once it's full the stream grows into
+    // a buffer from the allocator (or new[] without one) as usual, leaving the caller's buffer as it was.
+    WriteBitstream( uint8_t* buffer, size_t bufferCapacity, const WriteBitstreamAllocator* allocator = NULL )
+    {
+        Initialise( buffer, bufferCapacity, allocator );
+    }
+
+    // Stream through a buffer of bufferCapacity bytes (a multiple of 8 and > 0), which is given to the sink whenever it fills up
+    // rather than growing, so writing any amount takes only that much memory. Finish gives the sink the rest, after which it has
+    // had exactly ByteSize() bytes. RawData only holds what hasn't been given to the sink yet.
+    WriteBitstream( size_t bufferCapacity, const WriteBitstreamSink& sink )
+    {
+        Initialise( NULL, bufferCapacity, NULL );
+
+        m_sink = sink;
     }
 
     ~WriteBitstream()
     {
-        delete[] m_buffer;
+        FreeBuffer();
     }
 
     // Size in bits.
@@ -84,12 +134,26 @@ public:
     // Get the size in bytes
     size_t ByteSize() const { return ( m_size + 7 ) >> 3; }
 
-    // Finish writing by flushing the buffer.
+    // Finish writing by flushing the buffer (and giving the rest of the stream to the sink, if there is one).
     void Finish();
 
+    // Pad with zero bits up to the next byte boundary.
+    void AlignToByte();
+
+    // Append the contents of another (finished) bitstream.
+    void Append( const WriteBitstream& other );
+
     // Get the raw data for this buffer.
     const uint8_t* RawData() const { return m_buffer; }
 
+    // Take the (finished) buffer without copying it, leaving the stream empty without a buffer, so it can't be written to again.
+    // The caller then owns the buffer, which is freed with delete[] (or the allocator's Free, if it came from the allocator).
+    // If the stream is still in a caller owned buffer, that is what's returned.
+    uint8_t* Detach();
+
+    // Empty the stream to write it again from the start, keeping its buffer (so a stream can be reused without allocating).
+    void Reset();
+
     // Write a prefix code from the coding table to the stream.
     template <typename Ty>
     void WritePrefixCode( Ty input, const PrefixCode* codes );
@@ -112,8 +176,15 @@ public:
 
 private:
 
-    // If we need to grow the buffer.
+    void Initialise( uint8_t* buffer, size_t bufferCapacity, const WriteBitstreamAllocator* allocator );
+
+    // If we need to grow the buffer (or, with a sink, empty it).
     void GrowBuffer();
+
+    uint8_t* AllocateBuffer( size_t size );
+
+    // Free the buffer, if the stream owns it.
+    void FreeBuffer();
     
     // Not copyable
     WriteBitstream( const WriteBitstream& );
@@ -127,6 +198,16 @@ private:
     uint8_t*  m_bufferCursor;
     uint8_t*  m_bufferEnd;
     uint32_t  m_bitsLeft;
+
+    // Does the stream own m_buffer (rather than it being the caller's)?
+    bool      m_ownsBuffer;
+
+    // The allocator for the stream's buffers (Allocate is NULL for new[] and delete[]).
+    WriteBitstreamAllocator m_allocator;
+
+    // Where the buffer goes when it's full (Write is NULL to grow it instead), and how many bytes have gone there so far.
+    WriteBitstreamSink      m_sink;
+    size_t                  m_sunkBytes;
 };
 
 
@@ -154,7 +235,7 @@ WBS_INLINE uint32_t WriteBitstream::Log2( uint32_t input )
 
 #elif defined( __GNUC__ ) || defined( __clang__ )
 
-    return static_cast< uint32_t >( 31 - __builtin_clz( static_cast< unsigned int >( m_bitBuffer ) ) );
+    return static_cast< uint32_t >( 31 - __builtin_clz( static_cast< unsigned int >( input ) ) );
 
 #else
 
@@ -275,23 +356,144 @@ inline void WriteBitstream::Finish()
     m_bufferCursor[ 7 ] = ( m_bitBuffer >> 56 ) & 0xFF;
 
     m_bufferCursor += 8;
+
+    if ( m_sink.Write != NULL )
+    {
+        // Only the bytes holding written bits go to the sink.
+        size_t tailBytes = ByteSize() - m_sunkBytes;
+
+        m_sink.Write( m_buffer, tailBytes, m_sink.user );
+
+        m_sunkBytes += tailBytes;
+    }
+}
+
+
+inline void WriteBitstream::AlignToByte()
+{
+    uint32_t padding = static_cast< uint32_t >( ( 8 - ( m_size & 7 ) ) & 7 );
+
+    if ( padding > 0 )
+    {
+        Write( 0, padding );
+    }
+}
+
+
+inline void WriteBitstream::Append( const WriteBitstream& other )
+{
+    const uint8_t* cursor   = other.m_buffer;
+    size_t         bitsLeft = other.m_size;
+
+    for ( ; bitsLeft >= 32; bitsLeft -= 32, cursor += 4 )
+    {
+        Write( cursor[ 0 ] | ( cursor[ 1 ] << 8 ) | ( cursor[ 2 ] << 16 ) | ( static_cast< uint32_t >( cursor[ 3 ] ) << 24 ), 32 );
+    }
+
+    for ( ; bitsLeft > 0; bitsLeft -= ( bitsLeft < 8 ? bitsLeft : 8 ), ++cursor )
+    {
+        uint32_t bitCount = static_cast< uint32_t >( bitsLeft < 8 ? bitsLeft : 8 );
+
+        Write( *cursor & ( ( 1 << bitCount ) - 1 ), bitCount );
+    }
+}
+
+
+inline void WriteBitstream::Initialise( uint8_t* buffer, size_t bufferCapacity, const WriteBitstreamAllocator* allocator )
+{
+    m_allocator.Allocate = allocator != NULL ? allocator->Allocate : NULL;
+    m_allocator.Free     = allocator != NULL ? allocator->Free : NULL;
+    m_allocator.user     = allocator != NULL ? allocator->user : NULL;
+    m_sink.Write         = NULL;
+    m_sink.user          = NULL;
+    m_sunkBytes          = 0;
+    m_ownsBuffer         = buffer == NULL;
+    m_bufferCursor       =
+    m_buffer             = buffer != NULL ? buffer : AllocateBuffer( bufferCapacity );
+    m_bufferEnd          = m_buffer + bufferCapacity;
+    m_size               = 0;
+    m_bitsLeft           = 64;
+    m_bitBuffer          = 0;
+}
+
+
+inline uint8_t* WriteBitstream::AllocateBuffer( size_t size )
+{
+    return m_allocator.Allocate != NULL ? m_allocator.Allocate( size, m_allocator.user ) : new uint8_t[ size ];
+}
+
+
+inline void WriteBitstream::FreeBuffer()
+{
+    if ( !m_ownsBuffer )
+    {
+        return;
+    }
+
+    if ( m_allocator.Allocate == NULL )
+    {
+        delete[] m_buffer;
+    }
+    else if ( m_allocator.Free != NULL )
+    {
+        m_allocator.Free( m_buffer, m_allocator.user );
+    }
+}
+
+
+inline uint8_t* WriteBitstream::Detach()
+{
+    uint8_t* buffer = m_buffer;
+
+    m_bufferCursor =
+    m_buffer       =
+    m_bufferEnd    = NULL;
+    m_ownsBuffer   = false;
+    m_size         = 0;
+    m_bitsLeft     = 64;
+    m_bitBuffer    = 0;
+
+    return buffer;
+}
+
+
+inline void WriteBitstream::Reset()
+{
+    m_bufferCursor = m_buffer;
+    m_sunkBytes    = 0;
+    m_size         = 0;
+    m_bitsLeft     = 64;
+    m_bitBuffer    = 0;
 }
 
 
 WBS_INLINE void WriteBitstream::GrowBuffer()
 {
+    if ( m_sink.Write != NULL )
+    {
+        size_t bufferPosition = m_bufferCursor - m_buffer;
+
+        m_sink.Write( m_buffer, bufferPosition, m_sink.user );
+
+        m_sunkBytes   += bufferPosition;
+        m_bufferCursor = m_buffer;
+        return;
+    }
+
     size_t    bufferSize     = m_bufferEnd - m_buffer;
     size_t    newBufferSize  = bufferSize * 2;
     size_t    bufferPosition = m_bufferCursor - m_buffer;
-    uint8_t*  newBuffer      = new uint8_t[ newBufferSize ];
+    uint8_t*  newBuffer      = AllocateBuffer( newBufferSize );
 
-    ::memcpy( reinterpret_cast<void*>( newBuffer ), reinterpret_cast<void*>( m_buffer ), bufferSize );
+    // Only the bytes written so far need to move.
+    ::memcpy( reinterpret_cast<void*>( newBuffer ), reinterpret_cast<void*>( m_buffer ), bufferPosition );
 
-    delete[] m_buffer;
+    FreeBuffer();
 
     m_buffer       = newBuffer;
     m_bufferCursor = m_buffer + bufferPosition;
     m_bufferEnd    = m_buffer + newBufferSize;
+    m_ownsBuffer   = true;
 }
 
 